@@ -1,5 +1,7 @@
 #include "character.h"
-#include "octopus.h"
+#include "gl_state.h"
+#include "render_queue.h"
+#include "cpu_profiler.h"
 
 #include <vector>
 #include <string>
@@ -7,67 +9,31 @@
 #include <sstream>
 #include <iostream>
 #include <unordered_map>
-#include <chrono>
 #include <cmath>
 #include <algorithm>
 
-#include <gl/glew.h>
-#include <gl/freeglut.h>
-#include <gl/freeglut_ext.h>
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+#include <GL/freeglut_ext.h>
 
-#include <gl/glm/glm.hpp>
-#include <gl/glm/ext.hpp>
-#include <gl/glm/gtc/matrix_transform.hpp>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 struct Vertex {
     float px, py, pz;
     float nx, ny, nz;
 	float r, g, b;
+    float bone;       //     ȣ (RobotBone)
 };
 
+static_assert(BONE_COUNT <= MAX_BONES, "̴ bones[] ũ⸦ ÷ մϴ");
+
 static GLuint g_vao = 0;
 static GLuint g_vbo = 0;
 static GLuint g_ebo = 0;
 static GLsizei g_indexCount = 0;
-static GLuint g_shaderProg = 0;
-static GLint g_modelUniform = -1;
-static GLint g_colorUniform = -1;
-
-static glm::vec3 g_position = glm::vec3(0.0f, 0.0f, 0.0f);
-static glm::vec3 g_targetPosition = glm::vec3(0.0f, 0.0f, 0.0f);  // ǥ ġ
-
-//  ߰ (  Ʒ)
-static float g_yaw = 0.0f;
-static float g_targetYaw = 0.0f;            // ǥ ȸ 
-static const float ROTATION_SPEED = 0.15f;  // ȸ ӵ (ε巯)
-
-// [ӵ ý  ߰]
-static float g_currentSpeed = 0.0f;       //   ӵ
-static const float MIN_SPEED = 0.0f;      //  
-static const float MAX_SPEED = 0.3f;      // ִ ӵ (ʹ   )
-static const float ACCELERATION = 0.025f;   // ӵ (ʴ )
-static const float FRICTION = 3.5f;       //  (Ű   ߴ ӵ)
-
-static bool g_running = false;
-static bool g_jumpRequested = false;
-static float g_verticalVel = 0.0f;
-static bool g_grounded = true;
-static double g_timeTotal = 0.0;
-static std::chrono::steady_clock::time_point g_lastTime;
-
-static PlayerStun g_playerStun = { false, 0.5f, 0.0f };
-
-// κ  ȸ 
-static float g_leftArmRotation = 0.0f;
-static float g_rightArmRotation = 0.0f;
-static float g_leftLegRotation = 0.0f;
-static float g_rightLegRotation = 0.0f;
-
-// 谪
-static const float Bondray_Limit = 4.5f;
-
-//  ε巯  (0~1 ,    ε巯)
-static const float MOVEMENT_SMOOTHING = 0.15f;
+static const ShaderProgram* g_shader = nullptr;
 
 static void mat4_identity(float m[16]) {
     for (int i = 0; i < 16; i++) m[i] = 0.0f;
@@ -107,16 +73,6 @@ static void mat4_mul(const float a[16], const float b[16], float out[16]) {
         }
     }
 }
-
-//   Լ
-static float lerp(float current, float target, float speed) {
-    float diff = target - current;
-    if (fabsf(diff) < 0.001f) {
-        return target;
-    }
-    return current + diff * speed;
-}
-
 // ť  
 static void createCube(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
     vertices.clear();
@@ -124,35 +80,35 @@ static void createCube(std::vector<Vertex>& vertices, std::vector<unsigned int>&
 
     Vertex cubeVerts[] = {
         // ո (Z+)
-        { -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f },
-        {  0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 0.0f },
-        {  0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f },
-        { -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 1.0f },
+        { -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        { -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 1.0f,  0.0f, 0.0f },
         // ޸ (Z-)
-        {  0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f },
-        { -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f },
-        { -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f },
-        {  0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 1.0f },
+        {  0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        { -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        { -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 1.0f,  0.0f, 0.0f },
         //  (X-)
-        { -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 0.0f },
-        { -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f },
-        { -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 1.0f },
-        { -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f },
+        { -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        { -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        { -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        { -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f,  0.0f, 0.0f },
         //  (X+)
-        {  0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 0.0f },
-        {  0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f },
-        {  0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 1.0f },
-        {  0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f },
+        {  0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,  0.0f, 0.0f },
         //  (Y+)
-        { -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f },
-        {  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f },
-        {  0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 1.0f },
-        { -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f },
+        { -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        { -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,  0.0f, 0.0f },
         // Ʒ (Y-)
-        { -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f },
-        {  0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f },
-        {  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 1.0f },
-        { -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f },
+        { -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f,  0.0f, 0.0f },
+        {  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 1.0f,  0.0f, 0.0f },
+        { -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f,  0.0f, 0.0f },
     };
 
     unsigned int cubeIndices[] = {
@@ -184,6 +140,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 1. κ ü (߽)
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_BODY;
         v.px *= 0.4f;
         v.py *= 0.6f;
         v.pz *= 0.3f;
@@ -198,6 +155,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 2. κ Ӹ (  )
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_HEAD;
         v.px *= 0.35f;
         v.py *= 0.35f;
         v.pz *= 0.35f;
@@ -212,6 +170,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 3.  
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_LEFT_ARM;
         v.px *= 0.12f;
         v.py *= 0.35f;
         v.pz *= 0.12f;
@@ -227,6 +186,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 4.  
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_RIGHT_ARM;
         v.px *= 0.12f;
         v.py *= 0.35f;
         v.pz *= 0.12f;
@@ -242,6 +202,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 5.  Ʒ
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_LEFT_ARM;
         v.px *= 0.1f;
         v.py *= 0.35f;
         v.pz *= 0.1f;
@@ -257,6 +218,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 6.  Ʒ
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_RIGHT_ARM;
         v.px *= 0.1f;
         v.py *= 0.35f;
         v.pz *= 0.1f;
@@ -272,6 +234,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 7.  ٸ 
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_LEFT_LEG;
         v.px *= 0.13f;
         v.py *= 0.4f;
         v.pz *= 0.13f;
@@ -287,6 +250,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 8.  ٸ 
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_RIGHT_LEG;
         v.px *= 0.13f;
         v.py *= 0.4f;
         v.pz *= 0.13f;
@@ -302,6 +266,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 9.  ٸ Ʒ
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_LEFT_LEG;
         v.px *= 0.12f;
         v.py *= 0.4f;
         v.pz *= 0.12f;
@@ -317,6 +282,7 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     // 10.  ٸ Ʒ
     createCube(tempVerts, tempIndices);
     for (auto& v : tempVerts) {
+        v.bone = (float)BONE_RIGHT_LEG;
         v.px *= 0.12f;
         v.py *= 0.4f;
         v.pz *= 0.12f;
@@ -331,19 +297,19 @@ static void createRobotMesh(std::vector<Vertex>& vertices, std::vector<unsigned
     g_indexCount = (GLsizei)indices.size();
 }
 
-bool Character::initCharacter(const char* objPath, GLuint shaderProg) {
+bool Character::initCharacter(const char* objPath, ShaderVariants& shaders) {
     (void)objPath;
 
-    g_shaderProg = shaderProg;
-    g_modelUniform = glGetUniformLocation(shaderProg, "model");
-    g_colorUniform = glGetUniformLocation(shaderProg, "objectColor");
+    //  +  ȷƮ 
+    g_shader = shaders.get(VARIANT_LIT | VARIANT_SKINNED);
+    if (!g_shader) return false;
 
     std::vector<Vertex> verts;
     std::vector<unsigned int> idx;
     createRobotMesh(verts, idx);
 
     glGenVertexArrays(1, &g_vao);
-    glBindVertexArray(g_vao);
+    GLState::bindVertexArray(g_vao);
 
     glGenBuffers(1, &g_vbo);
     glBindBuffer(GL_ARRAY_BUFFER, g_vbo);
@@ -359,323 +325,57 @@ bool Character::initCharacter(const char* objPath, GLuint shaderProg) {
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, r));
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, nx));
+    // 8:  ȣ (̴ bones[] 迭 )
+    glEnableVertexAttribArray(8);
+    glVertexAttribPointer(8, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bone));
     
 
-    glBindVertexArray(0);
-
-    g_position = glm::vec3(0.0f, 20.0f, 0.0f);
-    g_targetPosition = glm::vec3(0.0f, 0.0f, 0.0f);
-    g_yaw = 0.0f;  // ʱⰪ: 0 ( )
-    g_targetYaw = 0.0f;  // ǥ ȸ  0 ʱȭ
-    g_running = false;
-    g_verticalVel = 0.0f;
-    g_grounded = false;
-	g_currentSpeed = 0.0f;
-    g_timeTotal = 0.0;
-    g_lastTime = std::chrono::steady_clock::now();
-    g_playerStun.isStunned = false;
-    g_playerStun.stunTimer = 0.0f;
+    GLState::bindVertexArray(0);
+
+    // ùķ̼ µ ó (character_sim.cpp)
+    resetState();
 
     std::cout << "[κ] ʱȭ Ϸ" << std::endl;
     return true;
 }
 
-void Character::moveForward(float speed) {
-    if (g_playerStun.isStunned) return;
-    g_targetPosition.z += g_currentSpeed;
-}
-
-void Character::moveBackward(float speed) {
-    if (g_playerStun.isStunned) return;
-    if (g_targetPosition.z > -5.0f) {
-        g_targetPosition.z -= g_currentSpeed;
-
-        if (g_targetPosition.z < -5.0f) {
-            g_targetPosition.z = -5.0f;
-        }
-    }
-    
-}
-
-void Character::moveLeft(float speed) {
-    if (g_playerStun.isStunned) return;
-
-    if (g_targetPosition.x < Bondray_Limit) {
-        g_targetPosition.x += g_currentSpeed;
-
-        //  ؼ 3.0  3.0  ( )
-        if (g_targetPosition.x > Bondray_Limit) {
-            g_targetPosition.x = Bondray_Limit;
-        }
-    }
-}
-
-void Character::moveRight(float speed) {
-    if (g_playerStun.isStunned) return;
-
-    if (g_targetPosition.x > -Bondray_Limit) {
-        g_targetPosition.x -= g_currentSpeed;
-
-        //  ؼ 3.0  3.0  ( )
-        if (g_targetPosition.x < -Bondray_Limit) {
-            g_targetPosition.x = -Bondray_Limit;
-        }
-    }
-}
-
-//  ߰ (  Ʒ)
-static int g_jumpCount = 0;          //   Ƚ
-static const int MAX_JUMPS = 2;       // ִ  Ƚ ()
-static const float DOUBLE_JUMP_FORCE = 5.0f;  //  
-
-// jump Լ 
-void Character::jump() {
-    if (g_jumpCount < MAX_JUMPS) {
-        g_jumpRequested = true;
-        g_jumpCount++;
-    }
-}
-
-
-// setTargetRotation Լ ߰
-void Character::setTargetRotation(float angle) {
-    g_targetYaw = angle;
+//  ť ֱ ( ġ, ´ б⸸)
+void Character::drawCharacter() {
+    PROFILE_ZONE("Character::drawCharacter");
+    submitRobot();
 }
 
-// drawCharacter Լ  ( ó κ)
-void Character::drawCharacter() {
+// ùķ̼    ڼ ״ κ  ť ֱ
+// (ʻȭó  ӿ ٸ     ׸  )
+void Character::submitRobot() {
     if (g_vao == 0 || g_indexCount == 0) return;
 
-	glUseProgram(g_shaderProg);
-    glBindVertexArray(g_vao);
-
-	// ð 
-    auto now = std::chrono::steady_clock::now();
-    double dt = std::chrono::duration<double>(now - g_lastTime).count();
-    g_lastTime = now;
-    if (dt > 0.1) dt = 0.1;
-    g_timeTotal += dt;
-
-    // --- [ӵ  ] ---
-    if (g_running && !g_playerStun.isStunned) {
-        // ޸ : ӵ 
-        g_currentSpeed += ACCELERATION * (float)dt;
-        if (g_currentSpeed > MAX_SPEED) g_currentSpeed = MAX_SPEED;
-    }
-    else {
-        // /: ӵ  ()
-        g_currentSpeed -= FRICTION * (float)dt;
-        if (g_currentSpeed < 0.0f) g_currentSpeed = 0.0f;
-    }
-
-    //   Ʈ
-    if (g_playerStun.isStunned) {
-        g_playerStun.stunTimer += dt;
-		g_currentSpeed = 0.0f;
-		g_jumpCount = 0; 
-        g_jumpRequested = false;
-        if (g_playerStun.stunTimer >= g_playerStun.stunDuration) {
-            g_playerStun.isStunned = false;
-            g_playerStun.stunTimer = 0.0f;
-        }
-    }
-
-    // g_colorUniform  ùٸ Ǿٸ Ʒ ڷ  ٲϴ.
-    if (g_colorUniform >= 0) {
-        if (g_playerStun.isStunned) {
-            //  :  
-            float blink = sin((float)g_timeTotal * 20.0f);
-            if (blink > 0) glUniform3f(g_colorUniform, 1.0f, 0.0f, 0.0f); // 
-            else glUniform3f(g_colorUniform, 1.0f, 1.0f, 0.0f);          // 
-        }
-        else {
-            //  : Ķ (ĳ )
-            // ٴ  иϱ  ⼭ Ȯϰ Ķ ־ݴϴ.
-            glUniform3f(g_colorUniform, 0.2f, 0.6f, 1.0f);
-        }
-    }
-
-    //  ġ ǥ ġ ε巴 ̵
-    g_position.x = lerp(g_position.x, g_targetPosition.x, MOVEMENT_SMOOTHING);
-    g_position.z = lerp(g_position.z, g_targetPosition.z, MOVEMENT_SMOOTHING);
-
-    // ȸҶ   
-    const float PI = 3.14159265f;
-    float diff = g_targetYaw - g_yaw;
-    while (diff > PI) diff -= 2 * PI;
-    while (diff < -PI) diff += 2 * PI;
-
-    // ִ η ε巴 ȸ
-    g_yaw += diff * ROTATION_SPEED;
-
-    //  ó ( )
-    if (g_jumpRequested) {
-        if (g_jumpCount == 1) {
-            // ù  (鿡)
-            g_verticalVel = 5.5f;
-            g_grounded = false;
-        } else if (g_jumpCount == 2) {
-            //  (߿)
-            g_verticalVel = DOUBLE_JUMP_FORCE;
-        }
-        g_jumpRequested = false;
-    }
-
-    if (!g_grounded) {
-        const float gravity = -9.81f;
-        g_verticalVel += gravity * (float)dt;
-        g_position.y += g_verticalVel * (float)dt;
-        if (g_position.y <= 0.0f) {
-            g_position.y = 0.0f;
-            g_verticalVel = 0.0f;
-            g_grounded = true;
-            g_jumpCount = 0;  // 鿡   Ƚ ʱȭ
-            std::cout << "!  Ƚ ʱȭ" << std::endl;
-        }
-    }
-
-    // κ ȴٸ ִϸ̼ (ȱ )
-    float walkAnimSpeed = 10.0f;
-    float swingAngle = 0.0f;
-    if (g_running || !g_grounded) {
-        swingAngle = sinf((float)g_timeTotal * walkAnimSpeed);
-    }
-    // ȴٸ ȸ  
-    float armRot = swingAngle * 0.8f;
-    float legRot = swingAngle * 0.6f;
-
-    glUseProgram(g_shaderProg);
-    glBindVertexArray(g_vao);
-   
-
-    // ⺻  ( )
+    // ⺻  ( ) - κ ü   ϳ ġ
+    RobotPose pose = getRenderPose();
     glm::mat4 rootModel = glm::mat4(1.0f);
-    rootModel = glm::translate(rootModel, g_position);
-    rootModel = glm::rotate(rootModel, g_yaw, glm::vec3(0.0f, 1.0f, 0.0f));
-
-    // [1]  ׸ (ε 0~36)
-    if (g_modelUniform >= 0)
-        glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(rootModel));
-
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(0 * sizeof(unsigned int)));
-
-
-    // [2] Ӹ ׸ (ε 36~72)
-    // Ӹ     ణ ġ ̰ obj Ե
-    if (g_modelUniform >= 0)
-        glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(rootModel));
-
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(36 * sizeof(unsigned int)));
-
-
-    // ǹ Ʈ (ȸ)
-    glm::vec3 shoulderL(-0.3f, 0.9f, 0.0f);
-    glm::vec3 shoulderR(0.3f, 0.9f, 0.0f);
-    glm::vec3 hipL(-0.13f, 0.1f, 0.0f);
-    glm::vec3 hipR(0.13f, 0.1f, 0.0f);
-
-
-    // [3]   ° ׸ ( + Ϲ)
-    {
-        glm::mat4 lArmMat = rootModel;
-        lArmMat = glm::translate(lArmMat, shoulderL);              // 1.  ġ ̵
-        lArmMat = glm::rotate(lArmMat, armRot, glm::vec3(1, 0, 0));  // 2. ȸ
-        lArmMat = glm::translate(lArmMat, -shoulderL);             // 3. ٽ 
-
-        //  
-        if (g_modelUniform >= 0)
-            glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(lArmMat));
-
-        //  ׸ (ε 72 36)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(72 * sizeof(unsigned int)));
-        // Ϲ ׸ (ε 144 36) -   Ƿ پ ٴ
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(144 * sizeof(unsigned int)));
-    }
-
-
-    // [4]   ° ׸
-    {
-        glm::mat4 rArmMat = rootModel;
-        rArmMat = glm::translate(rArmMat, shoulderR);
-        rArmMat = glm::rotate(rArmMat, -armRot, glm::vec3(1, 0, 0)); // ݴ ȸ
-        rArmMat = glm::translate(rArmMat, -shoulderR);
-
-        if (g_modelUniform >= 0)
-            glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(rArmMat));
-
-        //  (108)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(108 * sizeof(unsigned int)));
-        // Ϲ (180)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(180 * sizeof(unsigned int)));
-    }
-
-
-    // [5]  ٸ ° ׸
-    {
-        glm::mat4 lLegMat = rootModel;
-        lLegMat = glm::translate(lLegMat, hipL);
-        lLegMat = glm::rotate(lLegMat, -legRot, glm::vec3(1, 0, 0));
-        lLegMat = glm::translate(lLegMat, -hipL);
-
-        if (g_modelUniform >= 0)
-            glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(lLegMat));
-
-        //  (216)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(216 * sizeof(unsigned int)));
-        // Ƹ (288)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(288 * sizeof(unsigned int)));
-    }
-
-
-    // [6]  ٸ ° ׸
-    {
-        glm::mat4 rLegMat = rootModel;
-        rLegMat = glm::translate(rLegMat, hipR);
-        rLegMat = glm::rotate(rLegMat, legRot, glm::vec3(1, 0, 0));
-        rLegMat = glm::translate(rLegMat, -hipR);
-
-        if (g_modelUniform >= 0)
-            glUniformMatrix4fv(g_modelUniform, 1, GL_FALSE, glm::value_ptr(rLegMat));
-
-        //  (252)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(252 * sizeof(unsigned int)));
-        // Ƹ (324)
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, (void*)(324 * sizeof(unsigned int)));
-    }
-
-    glBindVertexArray(0);
-
-    Enemy::updateOctopus(g_position, (float)dt);
-    Enemy::drawOctopus();
-    Enemy::checkElectricityCollision(g_position, 0.5f, g_playerStun);
-    Enemy::drawElectricity();
+    rootModel = glm::translate(rootModel, pose.position);
+    rootModel = glm::rotate(rootModel, pose.yaw, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    // κ ü  :    ȣ bones[]   
+    DrawPacket robot;
+    robot.shader = g_shader;
+    robot.vao = g_vao;
+    robot.indexed = true;
+    robot.count = g_indexCount;
+    robot.model = rootModel;
+    robot.color = pose.bodyColor;
+    robot.hasColor = true;
+    robot.sortCenter = glm::vec3(0.0f, 0.6f, 0.0f); //  ߽
+    robot.bones = pose.bones;
+    robot.boneCount = pose.boneCount;
+    robot.profileScope = "robot";
+    RenderQueue::submit(robot);
 }
 
 void Character::cleanup() {
     if (g_ebo) { glDeleteBuffers(1, &g_ebo); g_ebo = 0; }
     if (g_vbo) { glDeleteBuffers(1, &g_vbo); g_vbo = 0; }
-    if (g_vao) { glDeleteVertexArrays(1, &g_vao); g_vao = 0; }
+    if (g_vao) { GLState::forgetVertexArray(g_vao); glDeleteVertexArrays(1, &g_vao); g_vao = 0; }
     g_indexCount = 0;
-    g_shaderProg = 0;
-    g_modelUniform = -1;
-    g_colorUniform = -1;
-}
-
-glm::vec3 Character::getPosition() {
-    return g_position;
-}
-
-void Character::setRunning(bool running) {
-    g_running = running;
-}
-
-bool Character::isStunned() {
-    return g_playerStun.isStunned;
-}
-
-void Character::applyStun(float duration) {
-    g_playerStun.isStunned = true;
-    g_playerStun.stunDuration = duration;
-    g_playerStun.stunTimer = 0.0f;
-	g_currentSpeed = 0.0f;
+    g_shader = nullptr;
 }
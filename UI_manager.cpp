@@ -1,17 +1,20 @@
-#include "UI_Manager.h"
+#include "UI_manager.h"
+#include "gl_state.h"
+#include "gl_context.h"
+#include "cpu_profiler.h"
 #include <cmath>
 #include <iostream>
 #include <cstdio>
 
 void UIManager::Init() {}
 
-void UIManager::DrawTitleScreen(int winW, int winH, GLuint textureID) {
+void UIManager::DrawTitleScreen(int winW, int winH, GLuint textureID, float loadProgress) {
     Begin2D(winW, winH);
 
     // ؽó   ׸
     if (textureID != 0) {
         glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, textureID);
+        GLState::bindTexture(GL_TEXTURE_2D, textureID);
 
         // ̹   ״ ǥ ( )
         glColor3f(1.0f, 1.0f, 1.0f);
@@ -24,10 +27,44 @@ void UIManager::DrawTitleScreen(int winW, int winH, GLuint textureID) {
         glTexCoord2f(1.0f, 1.0f); glVertex2f((float)winW, (float)winH); // 
         glTexCoord2f(0.0f, 1.0f); glVertex2f(0.0f, (float)winH);    // »
         glEnd();
+        GLState::countDraw(2);
 
         glDisable(GL_TEXTURE_2D);
     }
 
+    // ڻ ε ̸ Ʒʿ  
+    if (loadProgress < 1.0f) {
+        float w = winW * 0.4f, h = 12.0f;
+        float x = (winW - w) / 2.0f, y = 60.0f;
+        glColor3f(0.3f, 0.8f, 1.0f);
+        DrawRect(x, y, w * loadProgress, h, glm::vec3(0.3f, 0.8f, 1.0f));
+        DrawRectOutline(x, y, w, h, glm::vec3(0.8f, 0.8f, 0.8f));
+        DrawText(x, y + h + 10.0f, "Loading...");
+    }
+
+    End2D();
+}
+
+void UIManager::DrawPortrait(int winW, int winH, GLuint textureID, float x, float y, float size) {
+    if (textureID == 0) return;
+    Begin2D(winW, winH);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_TEXTURE_2D);
+    GLState::bindTexture(GL_TEXTURE_2D, textureID);
+    glColor3f(1.0f, 1.0f, 1.0f);
+
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 0.0f); glVertex2f(x, y);
+    glTexCoord2f(1.0f, 0.0f); glVertex2f(x + size, y);
+    glTexCoord2f(1.0f, 1.0f); glVertex2f(x + size, y + size);
+    glTexCoord2f(0.0f, 1.0f); glVertex2f(x, y + size);
+    glEnd();
+    GLState::countDraw(2);
+
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
     End2D();
 }
 
@@ -37,7 +74,7 @@ void UIManager::DrawFinishScreen(int winW, int winH, GLuint textureID, float fin
     // 1.  ̹ ׸ (ŸƲ )
     if (textureID != 0) {
         glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, textureID);
+        GLState::bindTexture(GL_TEXTURE_2D, textureID);
         glColor3f(1.0f, 1.0f, 1.0f);
 
         glBegin(GL_QUADS);
@@ -46,6 +83,7 @@ void UIManager::DrawFinishScreen(int winW, int winH, GLuint textureID, float fin
         glTexCoord2f(1.0f, 1.0f); glVertex2f((float)winW, (float)winH);
         glTexCoord2f(0.0f, 1.0f); glVertex2f(0.0f, (float)winH);
         glEnd();
+        GLState::countDraw(2);
         glDisable(GL_TEXTURE_2D);
     }
 
@@ -65,6 +103,7 @@ void UIManager::DrawFinishScreen(int winW, int winH, GLuint textureID, float fin
     glVertex2f(boxX + boxW, boxY + boxH);
     glVertex2f(boxX, boxY + boxH);
     glEnd();
+    GLState::countDraw(2);
     glDisable(GL_BLEND);
 
     // 3. ؽƮ 
@@ -78,7 +117,7 @@ void UIManager::DrawFinishScreen(int winW, int winH, GLuint textureID, float fin
     int ms = (int)((finalTime - (int)finalTime) * 100);
 
     char timeBuf[50];
-    sprintf_s(timeBuf, "RECORD: %02d:%02d:%02d", min, sec, ms);
+    snprintf(timeBuf, sizeof(timeBuf), "RECORD: %02d:%02d:%02d", min, sec, ms);
 
     //  
     DrawText(boxX + 110.0f, boxY + 120.0f, timeBuf, GLUT_BITMAP_TIMES_ROMAN_24, glm::vec3(1.0f, 1.0f, 1.0f)); // 
@@ -90,6 +129,7 @@ void UIManager::DrawFinishScreen(int winW, int winH, GLuint textureID, float fin
 }
 
 void UIManager::DrawAll(int winW, int winH, float currentZ, float totalDist, const std::string& timerText, bool isStunned) {
+    PROFILE_ZONE("UIManager::DrawAll");
     Begin2D(winW, winH);
 
     DrawTopRightTimer(winW, winH, timerText);
@@ -105,6 +145,28 @@ void UIManager::DrawAll(int winW, int winH, float currentZ, float totalDist, con
     End2D();
 }
 
+void UIManager::DrawStatsOverlay(int winW, int winH, const std::vector<std::string>& lines) {
+    if (lines.empty()) return;
+    Begin2D(winW, winH);
+
+    const float lineH = 15.0f;
+    const float x = 10.0f;
+    const float boxW = 420.0f;
+    const float boxH = lines.size() * lineH + 10.0f;
+    const float top = winH - 10.0f;
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glColor4f(0.0f, 0.0f, 0.0f, 0.6f);
+    DrawRect(x, top - boxH, boxW, boxH, glm::vec3(0.0f));
+    glDisable(GL_BLEND);
+
+    for (size_t i = 0; i < lines.size(); ++i)
+        DrawText(x + 6.0f, top - (i + 1) * lineH, lines[i].c_str(), GLUT_BITMAP_8_BY_13, glm::vec3(0.6f, 1.0f, 0.6f));
+
+    End2D();
+}
+
 void UIManager::DrawTopRightTimer(int winW, int winH, const std::string& text) {
     float w = 150.0f; float h = 50.0f; float x = winW - w - 20.0f; float y = winH - h - 20.0f;
     glColor4f(1.0f, 1.0f, 1.0f, 0.5f);
@@ -113,6 +175,7 @@ void UIManager::DrawTopRightTimer(int winW, int winH, const std::string& text) {
     glVertex2f(x, y); glVertex2f(x + w, y);
     glVertex2f(x + w + 20, y + h); glVertex2f(x - 20, y + h);
     glEnd();
+    GLState::countDraw(2);
     glDisable(GL_BLEND);
     DrawText(x + 20, y + 15, text.c_str(), GLUT_BITMAP_TIMES_ROMAN_24, glm::vec3(1, 1, 0));
     DrawText(x + 40, y + 38, "TIME", GLUT_BITMAP_HELVETICA_10);
@@ -137,6 +200,7 @@ void UIManager::DrawBottomRunningBar(int winW, int winH, float progress) {
         glVertex2f(x + w * progress, y + h);
         glColor3f(0.1f, 0.1f, 0.8f); glVertex2f(x, y + h);
         glEnd();
+        GLState::countDraw(2);
     }
 
     // ׵θ
@@ -152,7 +216,7 @@ void UIManager::DrawBottomRunningBar(int winW, int winH, float progress) {
 }
 
 void UIManager::Begin2D(int winW, int winH) {
-    glUseProgram(0);
+    GLState::useProgram(0);
 
     // 2. [ſ ߿] ؽó 
     // ̰  ϸ UI  ׸ ų ϴ.
@@ -172,16 +236,22 @@ void UIManager::End2D() {
 void UIManager::DrawRect(float x, float y, float w, float h, glm::vec3 color) {
     //  ܺ   (alpha  )
     glBegin(GL_QUADS); glVertex2f(x, y); glVertex2f(x + w, y); glVertex2f(x + w, y + h); glVertex2f(x, y + h); glEnd();
+    GLState::countDraw(2);
 }
 void UIManager::DrawRectOutline(float x, float y, float w, float h, glm::vec3 color, float lineWidth) {
     glColor3f(color.r, color.g, color.b); glLineWidth(lineWidth);
     glBegin(GL_LINE_LOOP); glVertex2f(x, y); glVertex2f(x + w, y); glVertex2f(x + w, y + h); glVertex2f(x, y + h); glEnd();
+    GLState::countDraw(0);
 }
 void UIManager::DrawCircle(float cx, float cy, float r, glm::vec3 color) {
     glColor3f(color.r, color.g, color.b); glBegin(GL_TRIANGLE_FAN); glVertex2f(cx, cy);
     for (int i = 0; i <= 30; ++i) { float t = 2.0f * 3.14159f * i / 30.0f; glVertex2f(cx + r * cosf(t), cy + r * sinf(t)); } glEnd();
+    GLState::countDraw(30);
 }
 void UIManager::DrawText(float x, float y, const char* text, void* font, glm::vec3 color) {
+    // ũ ؽƮ freeglut ʱȭ ʾƼ glut Ʈ ۲   
+    if (!GLContext::hasBitmapFonts()) return;
     glColor3f(color.r, color.g, color.b); glWindowPos2f(x, y);
-    for (const char* c = text; *c != '\0'; c++) glutBitmapCharacter(font, *c);
+    // ڸ glBitmap ϳ (ﰢ )
+    for (const char* c = text; *c != '\0'; c++) { glutBitmapCharacter(font, *c); GLState::countDraw(0); }
 }
\ No newline at end of file
@@ -1,15 +1,21 @@
 #pragma once
 #include <string>
-#include <gl/glew.h>
-#include <gl/freeglut.h>
-#include <gl/glm/glm.hpp>
+#include <vector>
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+#include <glm/glm.hpp>
 
 class UIManager {
 public:
     static void Init();
-    static void DrawTitleScreen(int winW, int winH, GLuint textureID);
+    // loadProgress < 1 ̸ ڻ ε  뵵  ׸
+    static void DrawTitleScreen(int winW, int winH, GLuint textureID, float loadProgress = 1.0f);
     static void DrawFinishScreen(int winW, int winH, GLuint textureID, float finalTime);
+    // ũ ׷  ʻȭ ؽó (x, y) size ũ  (  )
+    static void DrawPortrait(int winW, int winH, GLuint textureID, float x, float y, float size);
     static void DrawAll(int winW, int winH, float currentZ, float totalDist, const std::string& timerText, bool isStunned);
+    //    ڿ    (Ϸ  ߿ ǥ)
+    static void DrawStatsOverlay(int winW, int winH, const std::vector<std::string>& lines);
 
 private:
     static void DrawTopRightTimer(int winW, int winH, const std::string& text);
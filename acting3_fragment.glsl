@@ -1,46 +1,127 @@
 #version 330 core
+//  ShaderVariants #version ڿ ִ #define  (acting3_vertex.glsl )
 
 in vec3 FragPos;
+#ifdef LIT
 in vec3 Normal;
+#endif
+#ifdef TEXTURED
 in vec2 TexCoord;
+#endif
+#ifdef INSTANCE_COLOR
+in vec3 InstanceColor;
+#endif
+#ifdef LIGHTMAPPED
+in vec2 LightmapCoord;
+#endif
 
-uniform vec3 lightPos;
-uniform vec3 lightColor;
-uniform vec3 viewPos;
-uniform vec3 objectColor;
+// ī޶/ 丶   ŵǴ uniform  (shader_program.h CameraBlock  ġ)
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+    vec4 lightPos;
+    vec4 lightColor;
+    vec4 clusterScale;
+    vec4 clusterInfo;
+};
 
+#if defined(TEXTURED)
 uniform sampler2D wallTexture;
-uniform bool useTexture;
+#elif !defined(INSTANCE_COLOR)
+uniform vec3 objectColor;
+#endif
+
+#ifdef LIGHTMAPPED
+//   (tunnel.cpp bakeLightmap): 0~1  LIGHTMAP_SCALE  
+uniform sampler2D lightmap;
+uniform vec4 lightmapRect;
+const float LIGHTMAP_SCALE = 2.0;
+#endif
+
+#ifdef LIT
+// Ŭ  (light_grid.h )
+uniform samplerBuffer lightData;     //  2ؼ: ( ġ, ݰ), (, 0)
+uniform usamplerBuffer clusterGrid;  // Ŭ͸ ( ġ, )
+uniform usamplerBuffer lightIndices; //  ȣ 
+
+//  ׸Ʈ  Ŭ  
+vec3 clusterLights(vec3 norm, vec3 viewDir)
+{
+    if (clusterInfo.x < 0.5) return vec3(0.0);
+
+    float depth = -(view * vec4(FragPos, 1.0)).z;
+    int tileX = clamp(int(gl_FragCoord.x / clusterScale.x), 0, int(clusterInfo.y) - 1);
+    int tileY = clamp(int(gl_FragCoord.y / clusterScale.y), 0, int(clusterInfo.z) - 1);
+    int slice = clamp(int(log(max(depth, 1e-4)) * clusterScale.z + clusterScale.w), 0, int(clusterInfo.w) - 1);
+    int cluster = (slice * int(clusterInfo.z) + tileY) * int(clusterInfo.y) + tileX;
+
+    uvec2 range = texelFetch(clusterGrid, cluster).xy;
+    vec3 sum = vec3(0.0);
+    for (uint i = 0u; i < range.y; ++i) {
+        int light = int(texelFetch(lightIndices, int(range.x + i)).r);
+        vec4 posRadius = texelFetch(lightData, light * 2);
+        vec3 color = texelFetch(lightData, light * 2 + 1).rgb;
+
+        vec3 toLight = posRadius.xyz - FragPos;
+        float dist = length(toLight);
+        // ݰ濡 0 Ǵ ε巯 
+        float falloff = clamp(1.0 - dist / posRadius.w, 0.0, 1.0);
+        falloff *= falloff;
+        if (falloff <= 0.0) continue;
+
+        vec3 dir = toLight / max(dist, 1e-4);
+        float diff = max(dot(norm, dir), 0.0);
+        float spec = pow(max(dot(viewDir, reflect(-dir, norm)), 0.0), 32.0);
+        sum += (diff + 0.5 * spec) * falloff * color;
+    }
+    return sum;
+}
+#endif
 
 out vec4 FragColor;
 
 void main()
 {
-    // [߰] ؽó  ο   
-    vec3 baseColor;
-    if (useTexture) {
-        baseColor = texture(wallTexture, TexCoord).rgb;
-    } else {
-        baseColor = objectColor;
-    }
+    //  ó   (ؽó > νϽ  > objectColor)
+#if defined(TEXTURED)
+    vec3 baseColor = texture(wallTexture, TexCoord).rgb;
+#elif defined(INSTANCE_COLOR)
+    vec3 baseColor = InstanceColor;
+#else
+    vec3 baseColor = objectColor;
+#endif
 
+#if defined(LIGHTMAPPED)
+    //  ʴ :       
+    //   ûũ  ͸  ʵ    ؼ ڸ
+    vec2 halfTexel = 0.5 / vec2(textureSize(lightmap, 0));
+    vec2 lmCoord = clamp(LightmapCoord, lightmapRect.xy + halfTexel, lightmapRect.xy + lightmapRect.zw - halfTexel);
+    vec3 result = texture(lightmap, lmCoord).rgb * LIGHTMAP_SCALE * baseColor;
+#elif defined(LIT)
     // ֺ
     float ambientStrength = 0.3;
-    vec3 ambient = ambientStrength * lightColor;
+    vec3 ambient = ambientStrength * lightColor.rgb;
     
     // Diffuse
     vec3 norm = normalize(Normal);
-    vec3 lightDir = normalize(lightPos - FragPos);
+    vec3 lightDir = normalize(lightPos.xyz - FragPos);
     float diff = max(dot(norm, lightDir), 0.0);
-    vec3 diffuse = diff * lightColor;
+    vec3 diffuse = diff * lightColor.rgb;
     
     // Specular
     float specularStrength = 0.5;
-    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 viewDir = normalize(viewPos.xyz - FragPos);
     vec3 reflectDir = reflect(-lightDir, norm);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
-    vec3 specular = specularStrength * spec * lightColor;
+    vec3 specular = specularStrength * spec * lightColor.rgb;
     
-    vec3 result = (ambient + diffuse + specular) * baseColor;
+    // ͳ ,   
+    vec3 points = clusterLights(norm, viewDir);
+
+    vec3 result = (ambient + diffuse + specular + points) * baseColor;
+#else
+    vec3 result = baseColor;
+#endif
     FragColor = vec4(result, 1.0);
 }
\ No newline at end of file
@@ -1,21 +1,101 @@
 #version 330 core
+//  ShaderVariants #version ڿ ִ #define 
+// TEXTURED / LIT / INSTANCED / SKINNED / INSTANCE_COLOR / LIGHTMAPPED (shader_program.h ShaderVariantFlag)
 
 layout(location = 0) in vec3 vPos;
 layout(location = 1) in vec3 vNormal;
 layout(location = 2) in vec2 vTexCoord;
+#ifdef INSTANCED
+layout(location = 3) in mat4 vInstanceModel;  // νϽ̿   (3~6 )
+layout(location = 9) in mat3 vInstanceNormal; // νϽ   (9~11, CPU )
+#endif
+#ifdef INSTANCE_COLOR
+layout(location = 7) in vec3 vInstanceColor;  // νϽ  ( )
+#endif
+#ifdef SKINNED
+layout(location = 8) in float vBone;          //  ȣ (κ )
+#endif
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+// ī޶/ 丶   ŵǴ uniform  (shader_program.h CameraBlock  ġ)
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+    vec4 lightPos;
+    vec4 lightColor;
+    vec4 clusterScale;
+    vec4 clusterInfo;
+};
+
+uniform mat4 model;         // INSTANCED ûũ ġ,  Ÿ  νϽ Ӽ
+uniform mat3 normalMatrix;  // transpose(inverse(mat3(model))), CPU 
+#ifdef SKINNED
+uniform mat4 bones[6];       // shader_program.h MAX_BONES ƾ 
+uniform mat3 boneNormals[6]; // bones[]  
+#endif
+
+#ifdef LIGHTMAPPED
+uniform vec4 lightmapRect;   // Ʋ   ûũ  (u0, v0, , )
+
+// ͳ ܸ ģ ǥ (m):  (Ʒ) | ٴ(ޡ) |  (Ʒ)
+// tunnel.cpp bakeLightmap  ħ̾ 
+const float LM_MAP_WIDTH = 5.0;
+const float LM_WALL_TOP = 5.0;
+const float LM_WALL_BOTTOM = -1.0;
+const float LM_CHUNK_LENGTH = 32.0;
+
+vec2 tunnelUnwrap(vec3 p, vec3 n)
+{
+    float wallH = LM_WALL_TOP - LM_WALL_BOTTOM;
+    float u;
+    if (abs(n.y) >= abs(n.x)) u = wallH + clamp(p.x + LM_MAP_WIDTH, 0.0, 2.0 * LM_MAP_WIDTH); // ٴ ()
+    else if (n.x > 0.0) u = clamp(LM_WALL_TOP - p.y, 0.0, wallH);                              //    
+    else u = wallH + 2.0 * LM_MAP_WIDTH + clamp(p.y - LM_WALL_BOTTOM, 0.0, wallH);             //    
+    return vec2(u / (2.0 * wallH + 2.0 * LM_MAP_WIDTH), p.z / LM_CHUNK_LENGTH);
+}
+#endif
 
 out vec3 FragPos;
+#ifdef LIT
 out vec3 Normal;
+#endif
+#ifdef TEXTURED
 out vec2 TexCoord;
+#endif
+#ifdef INSTANCE_COLOR
+out vec3 InstanceColor;
+#endif
+#ifdef LIGHTMAPPED
+out vec2 LightmapCoord;
+#endif
 
 void main()
 {
-    FragPos = vec3(model * vec4(vPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * vNormal;
+    mat4 worldModel = model;
+    mat3 worldNormal = normalMatrix;
+#ifdef INSTANCED
+    worldModel = worldModel * vInstanceModel;
+    worldNormal = worldNormal * vInstanceNormal;
+#endif
+#ifdef SKINNED
+    int bone = int(vBone + 0.5);
+    worldModel = worldModel * bones[bone];
+    worldNormal = worldNormal * boneNormals[bone];
+#endif
+    FragPos = vec3(worldModel * vec4(vPos, 1.0));
+#ifdef LIT
+    Normal = worldNormal * vNormal;
+#endif
+#ifdef TEXTURED
     TexCoord = vTexCoord;
+#endif
+#ifdef INSTANCE_COLOR
+    InstanceColor = vInstanceColor;
+#endif
+#ifdef LIGHTMAPPED
+    // ûũ  ġ (model ûũ  ̵)
+    vec2 unwrapped = tunnelUnwrap(FragPos - model[3].xyz, worldNormal * vNormal);
+    LightmapCoord = lightmapRect.xy + unwrapped * lightmapRect.zw;
+#endif
     gl_Position = projection * view * vec4(FragPos, 1.0);
 }
\ No newline at end of file
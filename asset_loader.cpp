@@ -0,0 +1,267 @@
+#include "asset_loader.h"
+#include "texture_cache.h"
+#include "gl_state.h"
+#include "cpu_profiler.h"
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+
+namespace AssetLoader {
+
+    enum ItemKind { ITEM_TEXTURE, ITEM_JOB, ITEM_MAIN };
+
+    // û ϳ (۾  ->    )
+    struct Item {
+        ItemKind kind;
+        std::string name;
+        GLuint* outTexture = nullptr;
+        std::function<bool()> work;
+        std::function<bool()> finish;
+
+        bool workOk = false;
+        TextureCache::CookedTexture texture;  // ۾ 忡   .ctex
+        GLuint textureID = 0;
+        int nextLevel = 0;                    //  ø   ( ͺ)
+    };
+
+    static std::vector<std::thread> g_workers;
+    static std::mutex g_mutex;
+    static std::condition_variable g_cond;
+    static std::deque<Item*> g_workQueue;   // ۾ 尡 ó û
+    static std::deque<Item*> g_uploadQueue; // ۾ 尡  û ( 尡 GL ø)
+    static std::deque<Item*> g_mainQueue;   //    û ( )
+    static bool g_quit = false;
+
+    static int g_requested = 0;
+    static int g_completed = 0;
+    static bool g_failed = false;
+    static std::string g_failedName;
+    static int g_missingTextures = 0;       // ؼ 0  ؽó 
+    static std::string g_missingTextureName;
+
+    static GLuint g_stagingPBO = 0;
+
+    static void workerLoop() {
+        PROFILE_THREAD("asset loader");
+        while (true) {
+            Item* item;
+            {
+                std::unique_lock<std::mutex> lock(g_mutex);
+                g_cond.wait(lock, [] { return g_quit || !g_workQueue.empty(); });
+                if (g_quit) return;
+                item = g_workQueue.front();
+                g_workQueue.pop_front();
+            }
+
+            if (item->kind == ITEM_TEXTURE) {
+                item->workOk = TextureCache::prepare(item->name.c_str(), item->texture);
+                if (item->workOk) {
+                    //   ̸ о  (  memcpy  Ʈ  ʰ)
+                    volatile unsigned char sink = 0;
+                    for (int mip = 0; mip < item->texture.mipCount; ++mip) {
+                        const unsigned char* p = item->texture.levels[mip];
+                        for (unsigned int i = 0; i < item->texture.levelSizes[mip]; i += 4096) sink ^= p[i];
+                    }
+                    (void)sink;
+                }
+            }
+            else {
+                PROFILE_ZONE("AssetLoader job");
+                item->workOk = item->work();
+            }
+
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_uploadQueue.push_back(item);
+        }
+    }
+
+    static void stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_quit = true;
+        }
+        g_cond.notify_all();
+        for (auto& t : g_workers) {
+            if (t.joinable()) t.join();
+        }
+        g_workers.clear();
+    }
+
+    void init(int workerCount) {
+        if (workerCount < 1) workerCount = 1;
+        TextureCache::init();   // ۾ 尡   带  
+        g_quit = false;
+        for (int i = 0; i < workerCount; ++i) g_workers.push_back(std::thread(workerLoop));
+        // â ݱ  exit() ҷ ۾ 带 
+        std::atexit(stopWorkers);
+    }
+
+    void cleanup() {
+        stopWorkers();
+        if (g_stagingPBO) glDeleteBuffers(1, &g_stagingPBO);
+        g_stagingPBO = 0;
+    }
+
+    static void enqueueWork(Item* item) {
+        g_requested++;
+        {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_workQueue.push_back(item);
+        }
+        g_cond.notify_one();
+    }
+
+    void requestTexture(const char* filename, GLuint* outTexture) {
+        Item* item = new Item();
+        item->kind = ITEM_TEXTURE;
+        item->name = filename;
+        item->outTexture = outTexture;
+        enqueueWork(item);
+    }
+
+    void requestJob(const char* name, std::function<bool()> work, std::function<bool()> finish) {
+        Item* item = new Item();
+        item->kind = ITEM_JOB;
+        item->name = name;
+        item->work = work;
+        item->finish = finish;
+        enqueueWork(item);
+    }
+
+    void requestMainThread(const char* name, std::function<bool()> fn) {
+        Item* item = new Item();
+        item->kind = ITEM_MAIN;
+        item->name = name;
+        item->finish = fn;
+        g_requested++;
+        g_mainQueue.push_back(item);
+    }
+
+    static void fail(const Item* item) {
+        std::cerr << "[δ] : " << item->name << std::endl;
+        if (!g_failed) g_failedName = item->name;
+        g_failed = true;
+    }
+
+    //   ϳ PBO ¡ؼ ø. ؽó  true
+    static bool uploadNextLevel(Item* item) {
+        TextureCache::CookedTexture& tex = item->texture;
+        if (item->textureID == 0) {
+            item->textureID = TextureCache::createTexture(tex);
+            item->nextLevel = tex.mipCount - 1;
+        }
+        else {
+            GLState::bindTexture(GL_TEXTURE_2D, item->textureID);
+        }
+
+        //   ø (MAX_LEVEL  ö󰡾 ϼǹǷ  )
+        int level = item->nextLevel--;
+        GLsizeiptr size = (GLsizeiptr)tex.levelSizes[level];
+
+        if (g_stagingPBO == 0) glGenBuffers(1, &g_stagingPBO);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_stagingPBO);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW); //  ε ġ ʰ  
+        void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (dst) {
+            memcpy(dst, tex.levels[level], (size_t)size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            TextureCache::uploadLevel(tex, level, (const void*)0);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        else {
+            //   Ǹ CPU ͷ ٷ ø
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            TextureCache::uploadLevel(tex, level, tex.levels[level]);
+        }
+
+        if (item->nextLevel >= 0) return false;
+
+        std::cout << "ؽó ε : " << item->name << " (" << tex.width << "x" << tex.height
+                  << ",  " << tex.mipCount << "ܰ)" << std::endl;
+        *item->outTexture = item->textureID;
+        TextureCache::release(tex);
+        return true;
+    }
+
+    void pump(float budgetMs) {
+        PROFILE_ZONE("AssetLoader::pump");
+        auto start = std::chrono::steady_clock::now();
+        auto overBudget = [&]() {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count() >= budgetMs;
+        };
+
+        // 1)    ۾ (̴  )
+        while (!g_mainQueue.empty()) {
+            Item* item = g_mainQueue.front();
+            g_mainQueue.pop_front();
+            if (!item->finish()) fail(item);
+            g_completed++;
+            delete item;
+            if (overBudget()) return;
+        }
+
+        // 2) ۾ 尡  û GL ø
+        while (true) {
+            Item* item;
+            {
+                std::lock_guard<std::mutex> lock(g_mutex);
+                if (g_uploadQueue.empty()) return;
+                item = g_uploadQueue.front();
+            }
+
+            bool done = true;
+            if (!item->workOk) {
+                // ؽó ص 0 ΰ  ( LoadTexture ),   
+                if (item->kind != ITEM_TEXTURE) fail(item);
+                else if (g_missingTextures++ == 0) g_missingTextureName = item->name;
+            }
+            else if (item->kind == ITEM_TEXTURE) {
+                done = uploadNextLevel(item);
+            }
+            else if (!item->finish()) {
+                fail(item);
+            }
+
+            if (done) {
+                {
+                    std::lock_guard<std::mutex> lock(g_mutex);
+                    g_uploadQueue.pop_front();
+                }
+                g_completed++;
+                delete item;
+            }
+            if (overBudget()) return;
+        }
+    }
+
+    bool isReady() {
+        return g_completed == g_requested;
+    }
+
+    bool hasFailed() {
+        return g_failed;
+    }
+
+    const char* getFailedName() {
+        return g_failedName.c_str();
+    }
+
+    int getMissingTextureCount() {
+        return g_missingTextures;
+    }
+
+    const char* getMissingTextureName() {
+        return g_missingTextureName.c_str();
+    }
+
+    float getProgress() {
+        return (g_requested == 0) ? 1.0f : (float)g_completed / (float)g_requested;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <functional>
+#include <GL/glew.h>
+
+// 񵿱 ڻ δ (ŸƲ ȭ  ִ  ε)
+// - ̹ ڵ/ŷ, OBJ Ľ  CPU ۾ ۾ 忡
+// - GL ε   pump() Ӹ ð 길ŭ ݾ
+//   (ؽó   ϳ GL_PIXEL_UNPACK_BUFFER ¡ؼ ø)
+// - ̴ ó GL ؽƮ ʿ ۾ û   忡 
+//  û  isReady() true ˴ϴ (READY   ).
+namespace AssetLoader {
+    //  , GL ؽƮ   (TextureCache::init ⼭ θ)
+    void init(int workerCount);
+    void cleanup();
+
+    // ؽó:  *outTexture  (ϸ 0 ״,  )
+    void requestTexture(const char* filename, GLuint* outTexture);
+
+    // work: ۾  (GL ȣ ), finish:   (work  )
+    // ϳ false ָ ε з ϵ˴ϴ.
+    void requestJob(const char* name, std::function<bool()> work, std::function<bool()> finish);
+
+    //  忡 ϴ ۾ (û , Ӹ  ȿ)
+    void requestMainThread(const char* name, std::function<bool()> fn);
+
+    //    忡 ȣ. budgetMs ѱ   ̷ (ּ  ܰ )
+    void pump(float budgetMs);
+
+    bool isReady();           // û ڻ  ö󰬴
+    bool hasFailed();         //  ۾ ִ (ؽó )
+    const char* getFailedName();
+    int getMissingTextureCount();           // ε  ؽó  (hasFailed  )
+    const char* getMissingTextureName();    //  ù °
+    float getProgress();      // 0 ~ 1 ( û  / ü û )
+}
@@ -0,0 +1,158 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "benchmark.h"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+
+namespace Benchmark {
+
+    // GPU  ϳ  ü 
+    struct PassSamples {
+        std::string name;
+        std::vector<float> ms;
+    };
+
+    static bool g_active = false;
+    static std::chrono::steady_clock::time_point g_start;
+    static std::vector<FrameSample> g_frames;
+    static std::vector<float> g_gpuFrameMs;        // Ӻ GPU  
+    static std::vector<PassSamples> g_passes;      // ó  
+
+    void begin() {
+        g_frames.clear();
+        g_gpuFrameMs.clear();
+        g_passes.clear();
+        g_frames.reserve(1 << 14);
+        g_start = std::chrono::steady_clock::now();
+        g_active = true;
+    }
+
+    bool isActive() {
+        return g_active;
+    }
+
+    void addFrame(const FrameSample& sample) {
+        if (!g_active) return;
+        g_frames.push_back(sample);
+    }
+
+    void addGpuResult(const char* name, float ms) {
+        if (!g_active) return;
+        if (!name) {
+            g_gpuFrameMs.push_back(ms);
+            return;
+        }
+        for (auto& pass : g_passes) {
+            if (pass.name == name) {
+                pass.ms.push_back(ms);
+                return;
+            }
+        }
+        PassSamples pass;
+        pass.name = name;
+        pass.ms.push_back(ms);
+        g_passes.push_back(pass);
+    }
+
+    int getFrameCount() {
+        return (int)g_frames.size();
+    }
+
+    // avg/p50/p95/p99/max (GpuProfiler     )
+    static void writeStats(FILE* f, const char* key, std::vector<double> values) {
+        fprintf(f, "    \"%s\": {", key);
+        if (values.empty()) {
+            fprintf(f, "\"samples\": 0}");
+            return;
+        }
+        std::sort(values.begin(), values.end());
+        double sum = 0.0;
+        for (double v : values) sum += v;
+        int count = (int)values.size();
+        auto percentile = [&](double p) {
+            int i = (int)(p * (count - 1) + 0.5);
+            return values[std::min(count - 1, std::max(0, i))];
+        };
+        fprintf(f, "\"samples\": %d, \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+            count, sum / count, percentile(0.50), percentile(0.95), percentile(0.99), values.back());
+    }
+
+    // JSON ڿ (GL ڿ/ο   ִ ǥ, ,  ڸ ó)
+    static void writeJsonString(FILE* f, const std::string& s) {
+        fputc('"', f);
+        for (char c : s) {
+            if (c == '"' || c == '\\') fputc('\\', f);
+            if ((unsigned char)c < 0x20) c = ' ';
+            fputc(c, f);
+        }
+        fputc('"', f);
+    }
+
+    template <typename Getter>
+    static std::vector<double> column(Getter get) {
+        std::vector<double> values;
+        values.reserve(g_frames.size());
+        for (const FrameSample& s : g_frames) values.push_back((double)get(s));
+        return values;
+    }
+
+    bool writeReport(const char* path, const RunInfo& info) {
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - g_start).count();
+        FILE* f = fopen(path, "w");
+        if (!f) {
+            std::cerr << "[ġũ]    ϴ: " << path << std::endl;
+            return false;
+        }
+
+        unsigned long long simSteps = 0;
+        for (const FrameSample& s : g_frames) simSteps += s.simSteps;
+
+        fprintf(f, "{\n");
+        fprintf(f, "  \"seed\": %u,\n", info.seed);
+        fprintf(f, "  \"input\": ");
+        writeJsonString(f, info.input);
+        fprintf(f, ",\n  \"renderer\": ");
+        writeJsonString(f, info.renderer);
+        fprintf(f, ",\n  \"gl_version\": ");
+        writeJsonString(f, info.glVersion);
+        fprintf(f, ",\n  \"resolution\": [%d, %d],\n", info.width, info.height);
+        fprintf(f, "  \"distance_m\": %.2f,\n", info.distance);
+        fprintf(f, "  \"run_seconds\": %.3f,\n", info.runSeconds);
+        fprintf(f, "  \"wall_seconds\": %.3f,\n", wallSeconds);
+        fprintf(f, "  \"frames\": %d,\n", (int)g_frames.size());
+        fprintf(f, "  \"sim_steps\": %llu,\n", simSteps);
+
+        fprintf(f, "  \"frame\": {\n");
+        writeStats(f, "frame_ms", column([](const FrameSample& s) { return s.frameMs; }));
+        fprintf(f, ",\n");
+        writeStats(f, "cpu_ms", column([](const FrameSample& s) { return s.cpuMs; }));
+        fprintf(f, ",\n");
+        writeStats(f, "sim_ms", column([](const FrameSample& s) { return s.simMs; }));
+        fprintf(f, ",\n");
+        writeStats(f, "gpu_ms", std::vector<double>(g_gpuFrameMs.begin(), g_gpuFrameMs.end()));
+        fprintf(f, ",\n");
+        writeStats(f, "draw_calls", column([](const FrameSample& s) { return s.drawCalls; }));
+        fprintf(f, ",\n");
+        writeStats(f, "triangles", column([](const FrameSample& s) { return s.triangles; }));
+        fprintf(f, "\n  },\n");
+
+        // GPU  (RenderQueue profileScope / GpuProfiler::Scope ̸)
+        fprintf(f, "  \"gpu_passes\": {\n");
+        for (size_t i = 0; i < g_passes.size(); ++i) {
+            writeStats(f, g_passes[i].name.c_str(), std::vector<double>(g_passes[i].ms.begin(), g_passes[i].ms.end()));
+            fprintf(f, i + 1 < g_passes.size() ? ",\n" : "\n");
+        }
+        fprintf(f, "  }\n}\n");
+
+        bool ok = (fclose(f) == 0);
+        g_active = false;
+        if (!ok) {
+            std::cerr << "[ġũ]    ϴ: " << path << std::endl;
+            return false;
+        }
+        std::cout << "[ġũ]  " << g_frames.size() << ",  " << g_passes.size() << " : " << path << std::endl;
+        return true;
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <string>
+
+//  ġũ  (--benchmark)
+// ߺ α Ӹ CPU ð, GPU ð, draw call, ﰢ   ξٰ
+//   p50/p95/p99/max GPU  踦 JSON ϳ ϴ.
+// GpuProfiler/CpuProfiler ֱ â(SAMPLE_WINDOW) ޸  ü  մϴ.
+// GL ȣ :  main.cpp ־  (GPU  GpuProfiler::setResultListener addGpuResult)
+namespace Benchmark {
+    //  ϳ (drawScene  )
+    struct FrameSample {
+        float frameMs;              //   ۺ ̹  ۱ ( ð)
+        float cpuMs;                // drawScene ȿ  ð ( ȯ )
+        float simMs;                //  World::update
+        int simSteps;
+        unsigned int drawCalls;         //  +  + UI +  ػ blit (GLState::countDraw)
+        unsigned long long triangles;
+    };
+
+    //  Ӹ    
+    struct RunInfo {
+        unsigned int seed;
+        std::string input;          // ȭ   Ǵ "script"
+        std::string renderer;       // GL_RENDERER
+        std::string glVersion;      // GL_VERSION
+        int width;
+        int height;
+        float distance;             // ޸ Ÿ (m)
+        float runSeconds;           //    (ߺ α)
+    };
+
+    void begin();      //   (  )
+    bool isActive();
+    void addFrame(const FrameSample& sample);
+    void addGpuResult(const char* name, float ms);   // GpuProfiler::ResultListener 
+    int getFrameCount();
+
+    // JSON  . ϸ false
+    bool writeReport(const char* path, const RunInfo& info);
+}
@@ -1,32 +1,13 @@
 #pragma once
-#include <gl/glew.h>
-#include <gl/glm/glm.hpp>
-
-struct PlayerStun {
-    bool isStunned;
-    float stunDuration;
-    float stunTimer;
-};
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "shader_program.h"
+#include "character_sim.h"
 
+// κ ׸ (޽/VAO,  ť ). ¿  character_sim.h
 namespace Character {
-    bool initCharacter(const char* objPath, GLuint shaderProg);
-    void drawCharacter();
+    bool initCharacter(const char* objPath, ShaderVariants& shaders);
+    void drawCharacter();   //  ť ֱ (Ӵ  , ´ б⸸)
+    void submitRobot();     //    ڼ  ť ֱ
     void cleanup();
-
-    // ̵  ׼
-    void moveForward(float speed);
-    void moveBackward(float speed);
-    void moveLeft(float speed);
-    void moveRight(float speed);
-    void jump();
-
-    //    ȸ
-    void setTargetRotation(float angle);
-    void setRunning(bool running);
-
-	// ġ ȸ
-    glm::vec3 getPosition();
-
-    bool isStunned();
-    void applyStun(float duration);
-}
\ No newline at end of file
+}
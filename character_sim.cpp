@@ -0,0 +1,348 @@
+#include "character_sim.h"
+#include "world.h"
+#include "cpu_profiler.h"
+
+#include <cmath>
+
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// κ ùķ̼ (GL ): ̵///߷//ȴٸ ڼ
+// ׸(Character.cpp) 帮    
+
+static glm::mat4 g_bonePalette[BONE_COUNT]; //     ( ť flush )
+static glm::vec3 g_bodyColor = glm::vec3(0.2f, 0.6f, 1.0f); //    
+static unsigned int g_poseVersion = 0;      // ڼ(//) ٲ  
+
+static glm::vec3 g_position = glm::vec3(0.0f, 0.0f, 0.0f);
+static glm::vec3 g_targetPosition = glm::vec3(0.0f, 0.0f, 0.0f);  // ǥ ġ
+
+//  :   ġ/,     ׸ (0~1)
+static glm::vec3 g_prevPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+static float g_prevYaw = 0.0f;
+static float g_renderAlpha = 1.0f;
+
+//  ߰ (  Ʒ)
+static float g_yaw = 0.0f;
+static float g_targetYaw = 0.0f;            // ǥ ȸ 
+static const float ROTATION_SPEED = 0.15f;  // ȸ ӵ (ε巯, 60Hz   )
+
+// [ӵ ý  ߰]
+static float g_currentSpeed = 0.0f;       //   ӵ
+static const float MIN_SPEED = 0.0f;      //  
+// ӵ  m/s ( 16ms Ÿ̸   0.3m  Ͱ  )
+static const float MAX_SPEED = 18.75f;    // ִ ӵ (ʹ   )
+static const float ACCELERATION = 1.5625f;  // ӵ (ʴ )
+static const float FRICTION = 218.75f;    //  (Ű   ߴ ӵ)
+
+static bool g_running = false;
+static bool g_jumpRequested = false;
+static float g_verticalVel = 0.0f;
+static bool g_grounded = true;
+static double g_timeTotal = 0.0;
+
+static PlayerStun g_playerStun = { false, 0.5f, 0.0f };
+
+//  ߰ (  Ʒ)
+static int g_jumpCount = 0;          //   Ƚ
+static const int MAX_JUMPS = 2;       // ִ  Ƚ ()
+static const float DOUBLE_JUMP_FORCE = 5.0f;  //  
+
+// 谪
+static const float Bondray_Limit = 4.5f;
+static const float START_LIMIT_Z = -5.0f;   // ߼ ڷ   ִ Ѱ ( ǥ)
+static float g_originShiftZ = 0.0f;         // ÷  ݱ Ű Ÿ ()
+
+//  ε巯  (0~1 ,    ε巯)
+// 60Hz    Ÿ  % 󰡴̰,  ̰ ޶  Ⱑ ǵ smoothing() ٲ 
+static const float MOVEMENT_SMOOTHING = 0.15f;
+static const float SMOOTHING_REFERENCE_HZ = 60.0f;
+
+//   Լ
+static float lerp(float current, float target, float speed) {
+    float diff = target - current;
+    if (fabsf(diff) < 0.001f) {
+        return target;
+    }
+    return current + diff * speed;
+}
+
+// 60Hz     dt   (1 - (1-k)^(dt*60))
+static float smoothing(float perFrame, float dt) {
+    return 1.0f - powf(1.0f - perFrame, dt * SMOOTHING_REFERENCE_HZ);
+}
+
+//  ̸ -PI~PI (ִ )
+static float wrapAngle(float diff) {
+    const float PI = 3.14159265f;
+    while (diff > PI) diff -= 2 * PI;
+    while (diff < -PI) diff += 2 * PI;
+    return diff;
+}
+
+// ó · (߿  )
+void Character::resetState() {
+    g_position = glm::vec3(0.0f, 20.0f, 0.0f);
+    g_targetPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+    g_yaw = 0.0f;  // ʱⰪ: 0 ( )
+    g_targetYaw = 0.0f;  // ǥ ȸ  0 ʱȭ
+    g_running = false;
+    g_verticalVel = 0.0f;
+    g_grounded = false;
+	g_currentSpeed = 0.0f;
+    g_timeTotal = 0.0;
+    g_jumpRequested = false;
+    g_jumpCount = 0;
+    g_prevPosition = g_position;
+    g_prevYaw = g_yaw;
+    g_renderAlpha = 1.0f;
+    g_playerStun.isStunned = false;
+    g_playerStun.stunTimer = 0.0f;
+    g_originShiftZ = 0.0f;
+}
+
+void Character::moveForward(float dt) {
+    if (g_playerStun.isStunned) return;
+    g_targetPosition.z += g_currentSpeed * dt;
+}
+
+void Character::moveBackward(float dt) {
+    if (g_playerStun.isStunned) return;
+    //  Ű ߼  Ű ġ 
+    float limitZ = START_LIMIT_Z - g_originShiftZ;
+    if (g_targetPosition.z > limitZ) {
+        g_targetPosition.z -= g_currentSpeed * dt;
+
+        if (g_targetPosition.z < limitZ) {
+            g_targetPosition.z = limitZ;
+        }
+    }
+    
+}
+
+void Character::moveLeft(float dt) {
+    if (g_playerStun.isStunned) return;
+
+    if (g_targetPosition.x < Bondray_Limit) {
+        g_targetPosition.x += g_currentSpeed * dt;
+
+        //  ؼ 3.0  3.0  ( )
+        if (g_targetPosition.x > Bondray_Limit) {
+            g_targetPosition.x = Bondray_Limit;
+        }
+    }
+}
+
+void Character::moveRight(float dt) {
+    if (g_playerStun.isStunned) return;
+
+    if (g_targetPosition.x > -Bondray_Limit) {
+        g_targetPosition.x -= g_currentSpeed * dt;
+
+        //  ؼ 3.0  3.0  ( )
+        if (g_targetPosition.x < -Bondray_Limit) {
+            g_targetPosition.x = -Bondray_Limit;
+        }
+    }
+}
+
+// jump Լ 
+void Character::jump() {
+    if (g_jumpCount < MAX_JUMPS) {
+        g_jumpRequested = true;
+        g_jumpCount++;
+    }
+}
+
+
+// setTargetRotation Լ ߰
+void Character::setTargetRotation(float angle) {
+    g_targetYaw = angle;
+}
+
+//     (///߷/ε巯 ̵/ȴٸ ڼ)
+// dt ׻  (SIM_DT)̶  ӵ   
+void Character::update(float dt) {
+    PROFILE_ZONE("Character::update");
+
+    //   ̹    
+    g_prevPosition = g_position;
+    g_prevYaw = g_yaw;
+    g_timeTotal += dt;
+
+    // --- [ӵ  ] ---
+    if (g_running && !g_playerStun.isStunned) {
+        // ޸ : ӵ 
+        g_currentSpeed += ACCELERATION * (float)dt;
+        if (g_currentSpeed > MAX_SPEED) g_currentSpeed = MAX_SPEED;
+    }
+    else {
+        // /: ӵ  ()
+        g_currentSpeed -= FRICTION * (float)dt;
+        if (g_currentSpeed < 0.0f) g_currentSpeed = 0.0f;
+    }
+
+    //   Ʈ
+    if (g_playerStun.isStunned) {
+        g_playerStun.stunTimer += dt;
+		g_currentSpeed = 0.0f;
+		g_jumpCount = 0; 
+        g_jumpRequested = false;
+        if (g_playerStun.stunTimer >= g_playerStun.stunDuration) {
+            g_playerStun.isStunned = false;
+            g_playerStun.stunTimer = 0.0f;
+        }
+    }
+
+    // objectColor uniform ̴  Ʒ ڷ  ٲϴ.
+    glm::vec3 bodyColor;
+    float prevYaw = g_yaw;
+    glm::vec3 prevColor = g_bodyColor;
+    glm::mat4 prevPalette[BONE_COUNT];
+    for (int i = 0; i < BONE_COUNT; ++i) prevPalette[i] = g_bonePalette[i];
+    if (g_playerStun.isStunned) {
+        //  :  
+        float blink = sin((float)g_timeTotal * 20.0f);
+        if (blink > 0) bodyColor = glm::vec3(1.0f, 0.0f, 0.0f); // 
+        else bodyColor = glm::vec3(1.0f, 1.0f, 0.0f);          // 
+    }
+    else {
+        //  : Ķ (ĳ )
+        // ٴ  иϱ  ⼭ Ȯϰ Ķ ־ݴϴ.
+        bodyColor = glm::vec3(0.2f, 0.6f, 1.0f);
+    }
+
+    //  ġ ǥ ġ ε巴 ̵
+    float moveFactor = smoothing(MOVEMENT_SMOOTHING, dt);
+    g_position.x = lerp(g_position.x, g_targetPosition.x, moveFactor);
+    g_position.z = lerp(g_position.z, g_targetPosition.z, moveFactor);
+
+    // ִ η ε巴 ȸ
+    float diff = wrapAngle(g_targetYaw - g_yaw);
+    g_yaw += diff * smoothing(ROTATION_SPEED, dt);
+
+    //  ó ( )
+    if (g_jumpRequested) {
+        if (g_jumpCount == 1) {
+            // ù  (鿡)
+            g_verticalVel = 5.5f;
+            g_grounded = false;
+        } else if (g_jumpCount == 2) {
+            //  (߿)
+            g_verticalVel = DOUBLE_JUMP_FORCE;
+        }
+        g_jumpRequested = false;
+    }
+
+    if (!g_grounded) {
+        const float gravity = -9.81f;
+        g_verticalVel += gravity * (float)dt;
+        g_position.y += g_verticalVel * (float)dt;
+        if (g_position.y <= 0.0f) {
+            g_position.y = 0.0f;
+            g_verticalVel = 0.0f;
+            g_grounded = true;
+            g_jumpCount = 0;  // 鿡   Ƚ ʱȭ
+        }
+    }
+
+    // κ ȴٸ ִϸ̼ (ȱ )
+    float walkAnimSpeed = 10.0f;
+    float swingAngle = 0.0f;
+    if (g_running || !g_grounded) {
+        swingAngle = sinf((float)g_timeTotal * walkAnimSpeed);
+    }
+    // ȴٸ ȸ  
+    float armRot = swingAngle * 0.8f;
+    float legRot = swingAngle * 0.6f;
+
+    // ǹ Ʈ (ȸ)
+    glm::vec3 shoulderL(-0.3f, 0.9f, 0.0f);
+    glm::vec3 shoulderR(0.3f, 0.9f, 0.0f);
+    glm::vec3 hipL(-0.13f, 0.1f, 0.0f);
+    glm::vec3 hipR(0.13f, 0.1f, 0.0f);
+
+    //   ( ): ǹ ̵ -> ȸ -> ٽ 
+    // Ӹ     ణ ġ ̰ ޽ÿ Ե
+    g_bonePalette[BONE_BODY] = glm::mat4(1.0f);
+    g_bonePalette[BONE_HEAD] = glm::mat4(1.0f);
+    g_bonePalette[BONE_LEFT_ARM] = glm::translate(glm::rotate(glm::translate(glm::mat4(1.0f), shoulderL), armRot, glm::vec3(1, 0, 0)), -shoulderL);
+    g_bonePalette[BONE_RIGHT_ARM] = glm::translate(glm::rotate(glm::translate(glm::mat4(1.0f), shoulderR), -armRot, glm::vec3(1, 0, 0)), -shoulderR); // ݴ ȸ
+    g_bonePalette[BONE_LEFT_LEG] = glm::translate(glm::rotate(glm::translate(glm::mat4(1.0f), hipL), -legRot, glm::vec3(1, 0, 0)), -hipL);
+    g_bonePalette[BONE_RIGHT_LEG] = glm::translate(glm::rotate(glm::translate(glm::mat4(1.0f), hipR), legRot, glm::vec3(1, 0, 0)), -hipR);
+
+    g_bodyColor = bodyColor;
+
+    // ġ ̵ ʻȭ ī޶ 󰡹Ƿ ڼ ȭ ġ 
+    bool poseChanged = (g_yaw != prevYaw) || (g_bodyColor != prevColor);
+    for (int i = 0; i < BONE_COUNT && !poseChanged; ++i)
+        if (g_bonePalette[i] != prevPalette[i]) poseChanged = true;
+    if (poseChanged) g_poseVersion++;
+}
+
+// ̹ ӿ ׸ ġ:     alpha  (drawCharacter/submitRobot   )
+void Character::interpolate(float alpha) {
+    g_renderAlpha = alpha;
+}
+
+glm::vec3 Character::getRenderPosition() {
+    return glm::mix(g_prevPosition, g_position, g_renderAlpha);
+}
+
+// ׸:  ġ/ +   ڼ
+Character::RobotPose Character::getRenderPose() {
+    RobotPose pose;
+    pose.position = getRenderPosition();
+    pose.yaw = g_prevYaw + wrapAngle(g_yaw - g_prevYaw) * g_renderAlpha;
+    pose.bodyColor = g_bodyColor;
+    pose.bones = g_bonePalette;
+    pose.boneCount = BONE_COUNT;
+    return pose;
+}
+
+unsigned int Character::getPoseVersion() {
+    return g_poseVersion;
+}
+
+glm::vec3 Character::getPosition() {
+    return g_position;
+}
+
+void Character::shiftOrigin(float dz) {
+    g_position.z += dz;
+    g_prevPosition.z += dz;
+    g_targetPosition.z += dz;
+    g_originShiftZ -= dz;
+}
+
+void Character::setRunning(bool running) {
+    g_running = running;
+}
+
+bool Character::isStunned() {
+    return g_playerStun.isStunned;
+}
+
+void Character::applyStun(float duration) {
+    g_playerStun.isStunned = true;
+    g_playerStun.stunDuration = duration;
+    g_playerStun.stunTimer = 0.0f;
+	g_currentSpeed = 0.0f;
+}
+
+unsigned int Character::hashState(unsigned int h) {
+    h = World::hashBytes(h, &g_position, sizeof(g_position));
+    h = World::hashBytes(h, &g_targetPosition, sizeof(g_targetPosition));
+    h = World::hashBytes(h, &g_yaw, sizeof(g_yaw));
+    h = World::hashBytes(h, &g_targetYaw, sizeof(g_targetYaw));
+    h = World::hashBytes(h, &g_currentSpeed, sizeof(g_currentSpeed));
+    h = World::hashBytes(h, &g_verticalVel, sizeof(g_verticalVel));
+    h = World::hashBytes(h, &g_grounded, sizeof(g_grounded));
+    h = World::hashBytes(h, &g_jumpCount, sizeof(g_jumpCount));
+    h = World::hashBytes(h, &g_timeTotal, sizeof(g_timeTotal));
+    h = World::hashBytes(h, &g_playerStun.isStunned, sizeof(g_playerStun.isStunned));
+    h = World::hashBytes(h, &g_playerStun.stunTimer, sizeof(g_playerStun.stunTimer));
+    h = World::hashBytes(h, &g_originShiftZ, sizeof(g_originShiftZ));
+    return h;
+}
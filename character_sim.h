@@ -0,0 +1,64 @@
+#pragma once
+#include <glm/glm.hpp>
+
+// κ ùķ̼  (GL ): character_sim.cpp
+// (Character.cpp ׸⸦ ) 帮    
+
+struct PlayerStun {
+    bool isStunned;
+    float stunDuration;
+    float stunTimer;
+};
+
+// κ () ȣ - ̴ bones[] 迭 ε
+// /ٸ Ʒ  丷  븦 Ἥ Բ Դϴ.
+enum RobotBone {
+    BONE_BODY,
+    BONE_HEAD,
+    BONE_LEFT_ARM,
+    BONE_RIGHT_ARM,
+    BONE_LEFT_LEG,
+    BONE_RIGHT_LEG,
+    BONE_COUNT
+};
+
+namespace Character {
+    // ׸⿡ ʿ  ( ġ/ +   ڼ)
+    struct RobotPose {
+        glm::vec3 position;
+        float yaw;
+        glm::vec3 bodyColor;
+        const glm::mat4* bones;   // BONE_COUNT,  update ȿ
+        int boneCount;
+    };
+
+    void resetState();      //   · (߿  )
+    void update(float dt);  //    : /ִϸ̼  (World::update)
+    void interpolate(float alpha); // ׸ ġ =     alpha (0~1), ׸  Ӵ  
+    RobotPose getRenderPose();
+    unsigned int getPoseVersion(); // ڼ ٲ   (ʻȭ ٽ ׸ Ǵ)
+
+    // ̵  ׼ (Է ϴ  ܸ, dt   ӵ ǥ ġ ̵)
+    void moveForward(float dt);
+    void moveBackward(float dt);
+    void moveLeft(float dt);
+    void moveRight(float dt);
+    void jump();
+
+    //    ȸ
+    void setTargetRotation(float angle);
+    void setRunning(bool running);
+
+	// ġ ȸ (ùķ̼ ġ /  ׸ ġ)
+    glm::vec3 getPosition();
+    glm::vec3 getRenderPosition();
+
+    // ÷ :  ü Z dzŭ ű ( Ÿ float е )
+    void shiftOrigin(float dz);
+
+    bool isStunned();
+    void applyStun(float duration);
+
+    //  :  ܿ  ִ ¸ h   (World::checksum)
+    unsigned int hashState(unsigned int h);
+}
@@ -0,0 +1,43 @@
+#include "course.h"
+#include <cmath>
+
+namespace Course {
+
+    unsigned int hashChunk(unsigned int seed, int index) {
+        unsigned int h = seed ^ (unsigned int)index * 0x9E3779B9u;
+        h ^= h >> 16; h *= 0x7feb352du;
+        h ^= h >> 15; h *= 0x846ca68bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+    float chunkStartZ(int index) {
+        return TRACK_START_Z + index * CHUNK_LENGTH;
+    }
+
+    int getChunkIndex(double absZ) {
+        return (int)std::floor((absZ - TRACK_START_Z) / CHUNK_LENGTH);
+    }
+
+    int getLastChunkIndex(float courseLength) {
+        if (courseLength <= 0.0f) return -1;
+        return (int)std::ceil((courseLength - TRACK_START_Z) / CHUNK_LENGTH) - 1;
+    }
+
+    // ûũ index section°  
+    static int chunkAttackPattern(unsigned int seed, int index, int section) {
+        unsigned int h = hashChunk(seed, index);
+        for (int i = 0; i < section; ++i) h = hashChunk(h, i + 1);
+        return (int)(h % ATTACK_PATTERN_COUNT);
+    }
+
+    int getAttackPattern(unsigned int seed, double absZ) {
+        int index = getChunkIndex(absZ);
+        if (index < 0) index = 0;
+
+        int section = (int)((absZ - chunkStartZ(index)) / (CHUNK_LENGTH / ATTACK_SECTIONS));
+        if (section < 0) section = 0;
+        if (section >= ATTACK_SECTIONS) section = ATTACK_SECTIONS - 1;
+        return chunkAttackPattern(seed, index, section);
+    }
+}
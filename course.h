@@ -0,0 +1,24 @@
+#pragma once
+
+// ڽ Ģ (GL ,  ͳΰ 帮    )
+// ڽ CHUNK_LENGTH  ûũ , ûũ ATTACK_SECTIONS   
+// Ʈ õ ûũ ȣ մϴ. Ʈ ӵ  ̵ ϹǷ
+//  õ (ͳ ׸ ڽ) 帮   ޽ϴ.
+// ǥ   Z (߼ ).  Z ٲٴ  World  
+namespace Course {
+    static const float TRACK_START_Z = -10.0f;   // ڽ  (ĳ  10m)
+    static const float CHUNK_LENGTH = 32.0f;     // ûũ ϳ ϴ Z  (m)
+    static const int ATTACK_SECTIONS = 4;        // ûũ     (8m ϳ)
+    static const int ATTACK_PATTERN_COUNT = 5;   // octopus_sim.cpp switch 0~4
+
+    // ûũ ȣ ׻    ϴ   (rand()   )
+    unsigned int hashChunk(unsigned int seed, int index);
+
+    float chunkStartZ(int index);
+    int getChunkIndex(double absZ);             // absZ  ûũ (ڽ  ̸ )
+    int getLastChunkIndex(float courseLength);  //  ִ ûũ, courseLength <= 0 ()̸ -1
+
+    // absZ ġ   (0 ~ ATTACK_PATTERN_COUNT-1)
+    //  ( ĳͺ տ )  ڽ  Ģ ̾, ڽ   ù ûũ 
+    int getAttackPattern(unsigned int seed, double absZ);
+}
@@ -0,0 +1,148 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "cpu_profiler.h"
+#include <cstdio>
+#include <iostream>
+
+#if CPU_PROFILER_ENABLED
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <algorithm>
+#endif
+
+namespace CpuProfiler {
+
+#if CPU_PROFILER_ENABLED
+
+    struct Event {
+        const char* name;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    //  ϳ  (    ϳ)
+    struct ThreadBuffer {
+        Event events[EVENTS_PER_THREAD];
+        std::atomic<uint64_t> written;   // ݱ   (   ø)
+        std::string name;
+        int tid;
+    };
+
+    static const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+    static std::mutex g_registryMutex;    //  /̸/dump (Ͽ  )
+    static std::vector<std::unique_ptr<ThreadBuffer>> g_buffers;   // 尡    (dump)
+    static thread_local ThreadBuffer* t_buffer = nullptr;
+
+    static ThreadBuffer* threadBuffer() {
+        if (t_buffer) return t_buffer;
+        std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+        buffer->written.store(0, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        buffer->tid = (int)g_buffers.size() + 1;
+        buffer->name = "thread " + std::to_string(buffer->tid);
+        t_buffer = buffer.get();
+        g_buffers.push_back(std::move(buffer));
+        return t_buffer;
+    }
+
+    uint64_t now() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - g_epoch).count();
+    }
+
+    void record(const char* name, uint64_t beginNs, uint64_t endNs) {
+        ThreadBuffer* buffer = threadBuffer();
+        uint64_t n = buffer->written.load(std::memory_order_relaxed);
+        Event& e = buffer->events[n % EVENTS_PER_THREAD];
+        e.name = name;
+        e.begin = beginNs;
+        e.end = endNs;
+        buffer->written.store(n + 1, std::memory_order_release);
+    }
+
+    void setThreadName(const char* name) {
+        ThreadBuffer* buffer = threadBuffer();
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        buffer->name = name;
+    }
+
+    // JSON ڿ (̸ ڵ  ͷ̶ ǥ/ø ó)
+    static void writeJsonString(FILE* f, const char* s) {
+        fputc('"', f);
+        for (; *s; ++s) {
+            if (*s == '"' || *s == '\\') fputc('\\', f);
+            fputc(*s, f);
+        }
+        fputc('"', f);
+    }
+
+    int dump(const char* path, float seconds) {
+        uint64_t cutoff = now();
+        cutoff = (seconds > 0.0f && cutoff > (uint64_t)(seconds * 1e9)) ? cutoff - (uint64_t)(seconds * 1e9) : 0;
+
+        FILE* f = fopen(path, "w");
+        if (!f) {
+            std::cerr << "[CPU Ϸ]    ϴ: " << path << std::endl;
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        int count = 0;
+        std::vector<Event> events;
+        for (const auto& buffer : g_buffers) {
+            //  ̸
+            fprintf(f, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", buffer->tid);
+            writeJsonString(f, buffer->name.c_str());
+            fprintf(f, "}}");
+            first = false;
+
+            //    ġ ʰ:   written   ִ պκ 
+            uint64_t end = buffer->written.load(std::memory_order_acquire);
+            uint64_t begin = (end > (uint64_t)EVENTS_PER_THREAD) ? end - EVENTS_PER_THREAD : 0;
+            events.clear();
+            for (uint64_t i = begin; i < end; ++i) events.push_back(buffer->events[i % EVENTS_PER_THREAD]);
+            uint64_t after = buffer->written.load(std::memory_order_acquire);
+            uint64_t safeBegin = (after > (uint64_t)EVENTS_PER_THREAD) ? after - EVENTS_PER_THREAD : 0;
+            size_t skip = (safeBegin > begin) ? (size_t)std::min<uint64_t>(safeBegin - begin, events.size()) : 0;
+
+            for (size_t i = skip; i < events.size(); ++i) {
+                const Event& e = events[i];
+                if (e.end < cutoff) continue;
+                fprintf(f, ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":",
+                    buffer->tid, e.begin / 1000.0, (e.end - e.begin) / 1000.0);
+                writeJsonString(f, e.name);
+                fputc('}', f);
+                count++;
+            }
+        }
+        fprintf(f, "\n]}\n");
+        bool ok = (fclose(f) == 0);
+        if (!ok) return -1;
+        std::cout << "[CPU Ϸ] ֱ " << seconds << ",  " << count << " : " << path << std::endl;
+        return count;
+    }
+
+    bool isEnabled() {
+        return true;
+    }
+
+#else   // :  
+
+    void setThreadName(const char*) {}
+
+    int dump(const char* path, float) {
+        std::cout << "[CPU Ϸ]  忡 Ե ʾҽϴ (CPU_PROFILER_ENABLED=0): " << path << std::endl;
+        return -1;
+    }
+
+    bool isEnabled() {
+        return false;
+    }
+
+#endif
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+
+// CPU  Ϸ (Chrome trace / Perfetto JSON )
+// PROFILE_ZONE("̸") Լ   տ θ     / ð
+// 庰  ۿ   ϵ˴ϴ ( ,  steady_clock   + 16Ʈ ).
+// dump(, ) ֱ  ʸ chrome://tracing Ǵ ui.perfetto.dev  JSON մϴ.
+//
+//  (NDEBUG) ũΰ ƹ͵  ʽϴ.
+//  ѷ CPU_PROFILER_ENABLED=1 ϼ.
+#ifndef CPU_PROFILER_ENABLED
+#ifdef NDEBUG
+#define CPU_PROFILER_ENABLED 0
+#else
+#define CPU_PROFILER_ENABLED 1
+#endif
+#endif
+
+namespace CpuProfiler {
+    static const int EVENTS_PER_THREAD = 1 << 16;   //   ũ (ġ  ͺ )
+
+    //   ̸ (Ʈ̽  ̸),     
+    void setThreadName(const char* name);
+
+    // ֱ seconds  Chrome trace JSON .    (/̸ -1)
+    int dump(const char* path, float seconds);
+
+    bool isEnabled();   // CPU_PROFILER_ENABLED ƴ
+
+#if CPU_PROFILER_ENABLED
+    uint64_t now();     // Ϸ  ð (ns)
+    // name α׷    ִ ڿ ( ͷ)
+    void record(const char* name, uint64_t beginNs, uint64_t endNs);
+
+    struct Zone {
+        const char* name;
+        uint64_t begin;
+        explicit Zone(const char* zoneName) : name(zoneName), begin(now()) {}
+        ~Zone() { record(name, begin, now()); }
+    };
+#endif
+}
+
+#if CPU_PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) CpuProfiler::Zone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_THREAD(name) CpuProfiler::setThreadName(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
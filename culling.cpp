@@ -0,0 +1,43 @@
+#include "culling.h"
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+// [Լ 1]   (Gribb-Hartmann )
+//  켱(column-major) glm   (row)  ϰ ϴ.
+Frustum Culling::extractFrustum(const glm::mat4& m) {
+    glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    Frustum f;
+    f.planes[0] = row3 + row0; // 
+    f.planes[1] = row3 - row0; // 
+    f.planes[2] = row3 + row1; // Ʒ
+    f.planes[3] = row3 - row1; // 
+    f.planes[4] = row3 + row2; //  
+    f.planes[5] = row3 - row2; //  
+
+    for (int i = 0; i < 6; ++i) {
+        float len = glm::length(glm::vec3(f.planes[i]));
+        if (len > 0.0f) f.planes[i] = f.planes[i] / len;
+    }
+    return f;
+}
+
+// [Լ 2] AABB ˻
+//  鿡     ָ  (p-vertex) Ȯϸ ˴ϴ.
+//    ٱ̸  ü ٱԴϴ.
+bool Culling::isAABBVisible(const Frustum& frustum, const glm::vec3& boxMin, const glm::vec3& boxMax) {
+    for (int i = 0; i < 6; ++i) {
+        const glm::vec4& p = frustum.planes[i];
+        glm::vec3 farthest(
+            p.x >= 0.0f ? boxMax.x : boxMin.x,
+            p.y >= 0.0f ? boxMax.y : boxMin.y,
+            p.z >= 0.0f ? boxMax.z : boxMin.z);
+        if (p.x * farthest.x + p.y * farthest.y + p.z * farthest.z + p.w < 0.0f)
+            return false;
+    }
+    return true;
+}
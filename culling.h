@@ -0,0 +1,13 @@
+#pragma once
+#include <glm/glm.hpp>
+
+// ü(Frustum) ø 
+// projection * view Ŀ 6  ̾ AABB ȭ鿡 ġ ˻մϴ.
+struct Frustum {
+    glm::vec4 planes[6]; // (.xyz, Ÿ.w) -   
+};
+
+namespace Culling {
+    Frustum extractFrustum(const glm::mat4& viewProj);
+    bool isAABBVisible(const Frustum& frustum, const glm::vec3& boxMin, const glm::vec3& boxMax);
+}
@@ -0,0 +1,176 @@
+#include "debug_draw.h"
+#include "shader_program.h"
+#include "gl_state.h"
+#include <vector>
+#include <cstddef>
+#include <iostream>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+
+namespace DebugDraw {
+
+    // ġ(3) + (3) + (3)
+    struct DebugVertex {
+        glm::vec3 pos;
+        glm::vec3 normal;
+        glm::vec3 color;
+    };
+
+    static const size_t INITIAL_CAPACITY = 4096; //   (ť  110)
+
+    static ShaderProgram g_shader;
+    static GLuint g_vao = 0;
+    static GLuint g_vbo = 0;
+    static size_t g_capacity = 0;               // GPU  ũ ( )
+    static std::vector<DebugVertex> g_triangles; //    (뷮 )
+    static std::vector<DebugVertex> g_lines;
+    static int g_lastVertexCount = 0;
+
+    //  ť 36  (ġ +  ),  DrawCube  
+    static const float CUBE_VERTICES[36][6] = {
+        // ո (Z+)
+        {-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f}, { 0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f}, { 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f},
+        {-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f}, { 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f}, {-0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f},
+        // ޸ (Z-)
+        { 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f}, {-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f}, {-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f},
+        { 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f}, {-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f}, { 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f},
+        //   (X-)
+        {-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f}, {-0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f}, {-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f},
+        {-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f}, {-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f}, {-0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f},
+        //   (X+)
+        { 0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f}, { 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f}, { 0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f},
+        { 0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f}, { 0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f}, { 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f},
+        //  (Y+)
+        {-0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f}, { 0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f}, { 0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f},
+        {-0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f}, { 0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f}, {-0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f},
+        // Ʒ (Y-)
+        {-0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f}, { 0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f}, { 0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f},
+        {-0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f}, { 0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f}, {-0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f},
+    };
+
+    // GPU  ũ  (ڶ    ø)
+    static void reserveGPU(size_t vertexCount) {
+        if (vertexCount <= g_capacity) return;
+        size_t capacity = g_capacity ? g_capacity : INITIAL_CAPACITY;
+        while (capacity < vertexCount) capacity *= 2;
+        g_capacity = capacity;
+
+        glBindBuffer(GL_ARRAY_BUFFER, g_vbo);
+        glBufferData(GL_ARRAY_BUFFER, g_capacity * sizeof(DebugVertex), NULL, GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    bool init() {
+        if (!g_shader.build("debug_vertex.glsl", "debug_fragment.glsl")) {
+            std::cerr << " ׸ ̴ ʱȭ " << std::endl;
+            return false;
+        }
+
+        glGenVertexArrays(1, &g_vao);
+        glGenBuffers(1, &g_vbo);
+
+        GLState::bindVertexArray(g_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, g_vbo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, pos));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, normal));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(7, 3, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, color));
+        glEnableVertexAttribArray(7);
+        GLState::bindVertexArray(0);
+
+        reserveGPU(INITIAL_CAPACITY);
+        g_triangles.reserve(INITIAL_CAPACITY);
+        g_lines.reserve(INITIAL_CAPACITY / 4);
+        return true;
+    }
+
+    void cleanup() {
+        if (g_vbo) glDeleteBuffers(1, &g_vbo);
+        if (g_vao) {
+            GLState::forgetVertexArray(g_vao);
+            glDeleteVertexArrays(1, &g_vao);
+        }
+        g_vbo = 0;
+        g_vao = 0;
+        g_capacity = 0;
+        g_shader.destroy();
+        g_triangles.clear();
+        g_lines.clear();
+    }
+
+    void cube(const glm::mat4& model, const glm::vec3& color, const glm::vec3& scale) {
+        glm::mat4 world = glm::scale(model, scale);
+        //  ũ    ʵ ġ ķ ȯ
+        glm::mat3 normalMat = glm::transpose(glm::inverse(glm::mat3(world)));
+
+        for (int i = 0; i < 36; ++i) {
+            const float* v = CUBE_VERTICES[i];
+            DebugVertex dv;
+            dv.pos = glm::vec3(world * glm::vec4(v[0], v[1], v[2], 1.0f));
+            dv.normal = glm::normalize(normalMat * glm::vec3(v[3], v[4], v[5]));
+            dv.color = color;
+            g_triangles.push_back(dv);
+        }
+    }
+
+    void line(const glm::vec3& from, const glm::vec3& to, const glm::vec3& color) {
+        DebugVertex a = { from, glm::vec3(0.0f), color };
+        DebugVertex b = { to, glm::vec3(0.0f), color };
+        g_lines.push_back(a);
+        g_lines.push_back(b);
+    }
+
+    void box(const glm::vec3& mn, const glm::vec3& mx, const glm::vec3& color) {
+        glm::vec3 c[8] = {
+            glm::vec3(mn.x, mn.y, mn.z), glm::vec3(mx.x, mn.y, mn.z),
+            glm::vec3(mx.x, mx.y, mn.z), glm::vec3(mn.x, mx.y, mn.z),
+            glm::vec3(mn.x, mn.y, mx.z), glm::vec3(mx.x, mn.y, mx.z),
+            glm::vec3(mx.x, mx.y, mx.z), glm::vec3(mn.x, mx.y, mx.z),
+        };
+        for (int i = 0; i < 4; ++i) {
+            line(c[i], c[(i + 1) % 4], color);         //  簢
+            line(c[i + 4], c[(i + 1) % 4 + 4], color); //  簢
+            line(c[i], c[i + 4], color);               // ἱ
+        }
+    }
+
+    void flush() {
+        size_t triCount = g_triangles.size();
+        size_t lineCount = g_lines.size();
+        g_lastVertexCount = (int)(triCount + lineCount);
+        if (triCount + lineCount == 0 || g_vao == 0) return;
+
+        reserveGPU(triCount + lineCount);
+
+        //  ȭ(orphaning)    ø: ﰢ    ̾ 
+        glBindBuffer(GL_ARRAY_BUFFER, g_vbo);
+        glBufferData(GL_ARRAY_BUFFER, g_capacity * sizeof(DebugVertex), NULL, GL_STREAM_DRAW);
+        if (triCount)
+            glBufferSubData(GL_ARRAY_BUFFER, 0, triCount * sizeof(DebugVertex), g_triangles.data());
+        if (lineCount)
+            glBufferSubData(GL_ARRAY_BUFFER, triCount * sizeof(DebugVertex), lineCount * sizeof(DebugVertex), g_lines.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        g_shader.use();
+        GLState::bindVertexArray(g_vao);
+        if (triCount) {
+            glDrawArrays(GL_TRIANGLES, 0, (GLsizei)triCount);
+            GLState::countDraw(triCount / 3);
+        }
+        if (lineCount) {
+            glDrawArrays(GL_LINES, (GLint)triCount, (GLsizei)lineCount);
+            GLState::countDraw(0);
+        }
+        GLState::bindVertexArray(0);
+
+        g_triangles.clear();
+        g_lines.clear();
+    }
+
+    int getLastVertexCount() {
+        return g_lastVertexCount;
+    }
+}
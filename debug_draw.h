@@ -0,0 +1,24 @@
+#pragma once
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+// /⺻   ׸ API
+// ȣ  CPU 迭  װ, flush ϳ Ʈ ۿ   ÷
+// ﰢ(ť)  , (/ ׵θ)   draw call ׸ϴ.
+// ۿ VAO init     մϴ.
+namespace DebugDraw {
+    bool init();
+    void cleanup();
+
+    // ĥ ť (model  + scale,  DrawCube  )
+    void cube(const glm::mat4& model, const glm::vec3& color, const glm::vec3& scale);
+    // 
+    void line(const glm::vec3& from, const glm::vec3& to, const glm::vec3& color);
+    //    ׵θ ( 12)
+    void box(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::vec3& color);
+
+    //   ׸ ϴ. ī޶ UBO    ¿ ȣ.
+    void flush();
+
+    int getLastVertexCount(); //  flush ׸  
+}
@@ -0,0 +1,33 @@
+#version 330 core
+
+in vec3 FragPos;
+in vec3 Normal;
+in vec3 Color;
+
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+    vec4 lightPos;
+    vec4 lightColor;
+    vec4 clusterScale;
+    vec4 clusterInfo;
+};
+
+out vec4 FragColor;
+
+void main()
+{
+    // ( )    ״
+    if (dot(Normal, Normal) < 0.001) {
+        FragColor = vec4(Color, 1.0);
+        return;
+    }
+
+    // ť: ֺ + Ȯ걤 (acting3_fragment  )
+    vec3 ambient = 0.3 * lightColor.rgb;
+    vec3 norm = normalize(Normal);
+    vec3 lightDir = normalize(lightPos.xyz - FragPos);
+    vec3 diffuse = max(dot(norm, lightDir), 0.0) * lightColor.rgb;
+    FragColor = vec4((ambient + diffuse) * Color, 1.0);
+}
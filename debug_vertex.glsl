@@ -0,0 +1,28 @@
+#version 330 core
+
+layout(location = 0) in vec3 vPos;     //  ǥ (CPU ̹ ȯ)
+layout(location = 1) in vec3 vNormal;  //  (0,0,0)
+layout(location = 7) in vec3 vColor;   //  
+
+// ī޶/ 丶   ŵǴ uniform  (shader_program.h CameraBlock  ġ)
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+    vec4 viewPos;
+    vec4 lightPos;
+    vec4 lightColor;
+    vec4 clusterScale;
+    vec4 clusterInfo;
+};
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 Color;
+
+void main()
+{
+    FragPos = vPos;
+    Normal = vNormal;
+    Color = vColor;
+    gl_Position = projection * view * vec4(vPos, 1.0);
+}
@@ -0,0 +1,191 @@
+#include "dynamic_resolution.h"
+#include "gl_state.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+#include <GL/glew.h>
+
+namespace DynamicResolution {
+
+    static const float SMOOTHING = 0.1f;        //  ð  ̵  
+    static const int ADJUST_INTERVAL = 15;      // scale ٲ   ڸ   ٸ  
+    static const float OVER_BUDGET = 1.05f;     // ǥ 105%  
+    static const float UNDER_BUDGET = 0.85f;    // ǥ 85%  ø (̴ ״ =  )
+    static const float MAX_STEP_DOWN = 0.1f;    //   ̴ ִ  (  )
+    static const float STEP_UP = 0.05f;         //   ø  (  õõ)
+
+    static GLuint g_fbo = 0;
+    static GLuint g_colorTexture = 0;
+    static GLuint g_depthBuffer = 0;
+    static int g_targetW = 0;      // FBO ũ (â ũ  maxScale)
+    static int g_targetH = 0;
+    static int g_sceneW = 0;       // ̹   ũ
+    static int g_sceneH = 0;
+
+    static bool g_enabled = true;
+    static float g_scale = 1.0f;
+    static float g_minScale = 0.5f;
+    static float g_maxScale = 1.0f;
+    static float g_targetFrameMs = 16.6f;
+    static float g_smoothedMs = 0.0f;   // 0 =    
+    static int g_framesSinceChange = 0;
+
+    static void destroyTarget() {
+        if (g_fbo) glDeleteFramebuffers(1, &g_fbo);
+        if (g_depthBuffer) glDeleteRenderbuffers(1, &g_depthBuffer);
+        if (g_colorTexture) {
+            GLState::forgetTexture(g_colorTexture);
+            glDeleteTextures(1, &g_colorTexture);
+        }
+        g_fbo = 0;
+        g_depthBuffer = 0;
+        g_colorTexture = 0;
+        g_targetW = 0;
+        g_targetH = 0;
+    }
+
+    static bool createTarget(int w, int h) {
+        destroyTarget();
+
+        glGenTextures(1, &g_colorTexture);
+        GLState::bindTexture(GL_TEXTURE_2D, g_colorTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        GLState::bindTexture(GL_TEXTURE_2D, 0);
+
+        glGenRenderbuffers(1, &g_depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, g_depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, w, h);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &g_fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, g_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_colorTexture, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, g_depthBuffer);
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << " ػ FBO  : 0x" << std::hex << status << std::dec << std::endl;
+            destroyTarget();
+            return false;
+        }
+        g_targetW = w;
+        g_targetH = h;
+        return true;
+    }
+
+    // â ũ  maxScale (ּ 1ȼ)
+    static int maxExtent(int winSize) {
+        return std::max(1, (int)std::ceil(winSize * g_maxScale));
+    }
+
+    bool init(int winW, int winH) {
+        g_scale = g_maxScale;
+        g_smoothedMs = 0.0f;
+        g_framesSinceChange = 0;
+        return createTarget(maxExtent(winW), maxExtent(winH));
+    }
+
+    void cleanup() {
+        destroyTarget();
+    }
+
+    void beginScene(int winW, int winH) {
+        // â FBO Ŀ ٽ  (۾  ״ ΰ Ʈ )
+        if (g_enabled && (g_fbo == 0 || maxExtent(winW) > g_targetW || maxExtent(winH) > g_targetH)) {
+            if (!createTarget(maxExtent(winW), maxExtent(winH))) g_enabled = false;
+        }
+
+        if (!g_enabled || g_fbo == 0) {
+            g_sceneW = winW;
+            g_sceneH = winH;
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glViewport(0, 0, winW, winH);
+            return;
+        }
+
+        g_sceneW = std::min(g_targetW, std::max(1, (int)(winW * g_scale + 0.5f)));
+        g_sceneH = std::min(g_targetH, std::max(1, (int)(winH * g_scale + 0.5f)));
+        glBindFramebuffer(GL_FRAMEBUFFER, g_fbo);
+        glViewport(0, 0, g_sceneW, g_sceneH);
+    }
+
+    void endScene(int winW, int winH) {
+        if (g_enabled && g_fbo) {
+            // ũⰡ  ״ , ٸ  ͷ ø
+            GLenum filter = (g_sceneW == winW && g_sceneH == winH) ? GL_NEAREST : GL_LINEAR;
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, g_fbo);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+            glBlitFramebuffer(0, 0, g_sceneW, g_sceneH, 0, 0, winW, winH, GL_COLOR_BUFFER_BIT, filter);
+            GLState::countDraw(0);   // ȭ ũ    (ﰢ )
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, winW, winH);
+    }
+
+    void reportFrameTime(float frameMs) {
+        if (frameMs <= 0.0f) return;
+        g_smoothedMs = (g_smoothedMs <= 0.0f) ? frameMs : g_smoothedMs + (frameMs - g_smoothedMs) * SMOOTHING;
+        if (!g_enabled) return;
+
+        if (++g_framesSinceChange < ADJUST_INTERVAL) return;
+
+        float next = g_scale;
+        if (g_smoothedMs > g_targetFrameMs * OVER_BUDGET) {
+            //   ȼ (scale) Ѵٰ    ǥ ó
+            float wanted = g_scale * std::sqrt(g_targetFrameMs / g_smoothedMs);
+            next = std::max(wanted, g_scale - MAX_STEP_DOWN);
+        }
+        else if (g_smoothedMs < g_targetFrameMs * UNDER_BUDGET) {
+            next = g_scale + STEP_UP;
+        }
+        next = std::min(g_maxScale, std::max(g_minScale, next));
+
+        if (std::fabs(next - g_scale) > 0.001f) {
+            g_scale = next;
+            g_framesSinceChange = 0;
+        }
+    }
+
+    int getSceneWidth() {
+        return g_sceneW;
+    }
+
+    int getSceneHeight() {
+        return g_sceneH;
+    }
+
+    float getScale() {
+        return (g_enabled && g_fbo) ? g_scale : 1.0f;
+    }
+
+    float getSmoothedFrameMs() {
+        return g_smoothedMs;
+    }
+
+    void setEnabled(bool enabled) {
+        g_enabled = enabled;
+        g_framesSinceChange = 0;
+    }
+
+    bool isEnabled() {
+        return g_enabled;
+    }
+
+    void setTargetFrameMs(float ms) {
+        if (ms > 0.0f) g_targetFrameMs = ms;
+    }
+
+    void setScaleBounds(float minScale, float maxScale) {
+        // 0.25 ~ 2.0 (2.0̸ ۻø), min <= max
+        g_minScale = std::min(2.0f, std::max(0.25f, minScale));
+        g_maxScale = std::min(2.0f, std::max(g_minScale, maxScale));
+        g_scale = std::min(g_maxScale, std::max(g_minScale, g_scale));
+        // FBO ũ  beginScene  maxScale  ٽ  (Ŀ )
+    }
+}
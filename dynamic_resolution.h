@@ -0,0 +1,31 @@
+#pragma once
+#include <GL/glew.h>
+
+//  ػ
+// 3D  ũ FBO( + ) â ũ  scale ׸,  â ũ ÷ Դϴ.
+// scale ε巴   ð( ̵ ) ǥ ð ߵ [minScale, maxScale] ȿ մϴ.
+// HUD(UIManager::DrawAll) ʻȭ endScene ڿ ⺻ ӹۿ  ػ󵵷 ׸ϴ.
+// FBO  ū scale ũ   , scale ٲ Ʈ ٿ ÷ȴ մϴ.
+namespace DynamicResolution {
+    bool init(int winW, int winH);
+    void cleanup();
+
+    //  ׸ : FBO εϰ Ʈ  ũ (â Ŀ FBO ٽ )
+    // FBO (  / ) ⺻ ӹۿ ״ ׸
+    void beginScene(int winW, int winH);
+    //  â ũ ÷ ⺻ ӹۿ ϰ, Ʈ (0,0,winW,winH)  
+    void endScene(int winW, int winH);
+
+    // Ӹ  : ̹ ӿ ɸ ð(ms)   scale 
+    void reportFrameTime(float frameMs);
+
+    int getSceneWidth();    //   ũ (LightGrid Ÿ, gl_FragCoord )
+    int getSceneHeight();
+    float getScale();
+    float getSmoothedFrameMs();
+
+    void setEnabled(bool enabled);          //  scale 1  (񱳿)
+    bool isEnabled();
+    void setTargetFrameMs(float ms);        // ⺻ 16.6ms
+    void setScaleBounds(float minScale, float maxScale); // ⺻ 0.5 ~ 1.0
+}
@@ -0,0 +1,249 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "gl_context.h"
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+
+#if GL_CONTEXT_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#if GL_CONTEXT_OSMESA
+#include <GL/osmesa.h>
+#endif
+
+namespace GLContext {
+
+    static Backend g_backend = BACKEND_WINDOW;
+    static bool g_created = false;
+    static int g_width = 0;
+    static int g_height = 0;
+
+#if GL_CONTEXT_EGL
+    static EGLDisplay g_eglDisplay = EGL_NO_DISPLAY;
+    static EGLSurface g_eglSurface = EGL_NO_SURFACE;
+    static EGLContext g_eglContext = EGL_NO_CONTEXT;
+
+    // ÷  : surfaceless ÷ ÷ + pbuffer (pbuffer ⺻ ӹ۰ )
+    static bool createEGL(int width, int height) {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay) g_eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (g_eglDisplay == EGL_NO_DISPLAY) g_eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+        EGLint major = 0, minor = 0;
+        if (g_eglDisplay == EGL_NO_DISPLAY || !eglInitialize(g_eglDisplay, &major, &minor)) {
+            std::cerr << "[GL ؽƮ] EGL ÷̸ ʱȭ  ϴ" << std::endl;
+            return false;
+        }
+
+        const EGLint configAttribs[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+            EGL_DEPTH_SIZE, 24,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(g_eglDisplay, configAttribs, &config, 1, &configCount) || configCount == 0) {
+            std::cerr << "[GL ؽƮ] ´ EGL  ϴ (pbuffer + ũ GL)" << std::endl;
+            return false;
+        }
+
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        g_eglSurface = eglCreatePbufferSurface(g_eglDisplay, config, pbufferAttribs);
+        if (g_eglSurface == EGL_NO_SURFACE) {
+            std::cerr << "[GL ؽƮ] EGL pbuffer   ϴ" << std::endl;
+            return false;
+        }
+
+        //    = ȣȯ  (UI   )
+        eglBindAPI(EGL_OPENGL_API);
+        g_eglContext = eglCreateContext(g_eglDisplay, config, EGL_NO_CONTEXT, nullptr);
+        if (g_eglContext == EGL_NO_CONTEXT || !eglMakeCurrent(g_eglDisplay, g_eglSurface, g_eglSurface, g_eglContext)) {
+            std::cerr << "[GL ؽƮ] EGL ؽƮ   ϴ" << std::endl;
+            return false;
+        }
+        std::cout << "[GL ؽƮ] EGL " << major << "." << minor << " surfaceless pbuffer " << width << "x" << height << std::endl;
+        return true;
+    }
+
+    static void destroyEGL() {
+        if (g_eglDisplay == EGL_NO_DISPLAY) return;
+        eglMakeCurrent(g_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (g_eglContext != EGL_NO_CONTEXT) eglDestroyContext(g_eglDisplay, g_eglContext);
+        if (g_eglSurface != EGL_NO_SURFACE) eglDestroySurface(g_eglDisplay, g_eglSurface);
+        eglTerminate(g_eglDisplay);
+        g_eglDisplay = EGL_NO_DISPLAY;
+        g_eglSurface = EGL_NO_SURFACE;
+        g_eglContext = EGL_NO_CONTEXT;
+    }
+#endif
+
+#if GL_CONTEXT_OSMESA
+    static OSMesaContext g_osmesaContext = nullptr;
+    static std::vector<unsigned char> g_osmesaBuffer;   // RGBA8   (OSMesa ⿡ ׸)
+
+    static bool createOSMesa(int width, int height) {
+        g_osmesaContext = OSMesaCreateContextExt(OSMESA_RGBA, 24, 8, 0, nullptr);
+        if (!g_osmesaContext) {
+            std::cerr << "[GL ؽƮ] OSMesa ؽƮ   ϴ" << std::endl;
+            return false;
+        }
+        g_osmesaBuffer.assign((size_t)width * height * 4, 0);
+        if (!OSMesaMakeCurrent(g_osmesaContext, g_osmesaBuffer.data(), GL_UNSIGNED_BYTE, width, height)) {
+            std::cerr << "[GL ؽƮ] OSMesa ۸   ϴ" << std::endl;
+            return false;
+        }
+        std::cout << "[GL ؽƮ] OSMesa " << width << "x" << height << std::endl;
+        return true;
+    }
+
+    static void destroyOSMesa() {
+        if (g_osmesaContext) OSMesaDestroyContext(g_osmesaContext);
+        g_osmesaContext = nullptr;
+        g_osmesaBuffer.clear();
+    }
+#endif
+
+    bool parseBackend(const char* name, Backend& out) {
+        if (strcmp(name, "window") == 0) out = BACKEND_WINDOW;
+        else if (strcmp(name, "egl") == 0) out = BACKEND_EGL;
+        else if (strcmp(name, "osmesa") == 0) out = BACKEND_OSMESA;
+        else return false;
+        return true;
+    }
+
+    const char* getBackendName(Backend backend) {
+        switch (backend) {
+        case BACKEND_EGL: return "egl";
+        case BACKEND_OSMESA: return "osmesa";
+        default: return "window";
+        }
+    }
+
+    bool create(Backend backend, int* argc, char** argv, int width, int height, const char* title) {
+        g_backend = backend;
+        g_width = width;
+        g_height = height;
+
+        bool ok = false;
+        switch (backend) {
+        case BACKEND_WINDOW:
+            glutInit(argc, argv);
+            glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
+            glutInitWindowPosition(100, 100);
+            glutInitWindowSize(width, height);
+            ok = glutCreateWindow(title) > 0;
+            break;
+        case BACKEND_EGL:
+#if GL_CONTEXT_EGL
+            ok = createEGL(width, height);
+#else
+            std::cerr << "[GL ؽƮ]  忡 EGL 鿣尡 ϴ (GL_CONTEXT_EGL=0)" << std::endl;
+#endif
+            break;
+        case BACKEND_OSMESA:
+#if GL_CONTEXT_OSMESA
+            ok = createOSMesa(width, height);
+#else
+            std::cerr << "[GL ؽƮ]  忡 OSMesa 鿣尡 ϴ (GL_CONTEXT_OSMESA=0)" << std::endl;
+#endif
+            break;
+        }
+        if (!ok) return false;
+
+        // â ó glewInit, ũ GLX/WGL Ȯ Ȯ  GL Լ (÷̰ Ƿ)
+        glewExperimental = GL_TRUE;
+#if GL_CONTEXT_EGL || GL_CONTEXT_OSMESA
+        if (backend != BACKEND_WINDOW) {
+            GLenum err = glewContextInit();
+            if (err != GLEW_OK) {
+                std::cerr << "[GL ؽƮ] GLEW ʱȭ : " << glewGetErrorString(err) << std::endl;
+                destroy();
+                return false;
+            }
+            g_created = true;
+            return true;
+        }
+#endif
+        glewInit();
+        g_created = true;
+        return true;
+    }
+
+    void destroy() {
+        switch (g_backend) {
+        case BACKEND_EGL:
+#if GL_CONTEXT_EGL
+            destroyEGL();
+#endif
+            break;
+        case BACKEND_OSMESA:
+#if GL_CONTEXT_OSMESA
+            destroyOSMesa();
+#endif
+            break;
+        default:
+            break;   // â freeglut   
+        }
+        g_created = false;
+    }
+
+    Backend getBackend() {
+        return g_backend;
+    }
+
+    bool isOffscreen() {
+        return g_backend != BACKEND_WINDOW;
+    }
+
+    bool hasBitmapFonts() {
+        return g_created && g_backend == BACKEND_WINDOW;
+    }
+
+    void swapBuffers() {
+        if (g_backend == BACKEND_WINDOW) glutSwapBuffers();
+        else glFinish();
+    }
+
+    void postRedisplay() {
+        if (g_backend == BACKEND_WINDOW) glutPostRedisplay();
+    }
+
+    void mainLoop(void (*display)(), void (*reshape)(int, int)) {
+        if (g_backend == BACKEND_WINDOW) {
+            glutMainLoop();
+            return;
+        }
+        reshape(g_width, g_height);
+        for (;;) display();
+    }
+
+    bool saveFramebuffer(const char* path) {
+        std::vector<unsigned char> pixels((size_t)g_width * g_height * 3);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, g_width, g_height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+
+        FILE* f = fopen(path, "wb");
+        if (!f) {
+            std::cerr << "[GL ؽƮ]    ϴ: " << path << std::endl;
+            return false;
+        }
+        // GL Ʒ ٺ, PPM  ٺ
+        fprintf(f, "P6\n%d %d\n255\n", g_width, g_height);
+        bool ok = true;
+        size_t rowBytes = (size_t)g_width * 3;
+        for (int y = g_height - 1; y >= 0 && ok; --y)
+            ok = fwrite(pixels.data() + y * rowBytes, rowBytes, 1, f) == 1;
+        ok = (fclose(f) == 0) && ok;
+        if (!ok) std::cerr << "[GL ؽƮ]    ϴ: " << path << std::endl;
+        return ok;
+    }
+}
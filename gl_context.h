@@ -0,0 +1,52 @@
+#pragma once
+
+// GL ؽƮ 鿣
+// â(freeglut)  ÷   ũ ׸ ؽƮ   ֽϴ.
+//  ̵ ⺻ ӹ(0) width x height Ƿ drawScene  н ״ ϴ.
+//   window : freeglut â ( , Ű Է)
+//   egl    : EGL_MESA_platform_surfaceless + pbuffer (X/Wayland  , Mesa llvmpipe )
+//   osmesa : OSMesa ޸  (OSMesa  ִ  Mesa, GLEW GLEW_OSMESA ؾ )
+// ũ freeglut ʱȭ Ƿ glutBitmapCharacter ڴ ׸ ʽϴ (hasBitmapFonts).
+//
+// 忡  鿣 GL_CONTEXT_EGL / GL_CONTEXT_OSMESA ϴ (EGL  ⺻ ).
+#ifndef GL_CONTEXT_EGL
+#if defined(__linux__)
+#define GL_CONTEXT_EGL 1
+#else
+#define GL_CONTEXT_EGL 0
+#endif
+#endif
+#ifndef GL_CONTEXT_OSMESA
+#define GL_CONTEXT_OSMESA 0
+#endif
+
+namespace GLContext {
+    enum Backend {
+        BACKEND_WINDOW,
+        BACKEND_EGL,
+        BACKEND_OSMESA
+    };
+
+    // "window" / "egl" / "osmesa" (--backend)
+    bool parseBackend(const char* name, Backend& out);
+    const char* getBackendName(Backend backend);
+
+    // ؽƮ     GLEW ʱȭ.  忡  鿣ų ϸ false
+    // â̸ argc/argv glutInit ѱ (glut ڴ )
+    bool create(Backend backend, int* argc, char** argv, int width, int height, const char* title);
+    void destroy();
+
+    Backend getBackend();
+    bool isOffscreen();
+    bool hasBitmapFonts();      // glutBitmapCharacter   ִ (â )
+
+    //  : â  ȯ, ũ GPU   ٸ (ȯ   ڸ)
+    void swapBuffers();
+    void postRedisplay();       // â: glutPostRedisplay / ũ:   ׸
+
+    // â: glutMainLoop (ݹ ȣ  ) / ũ: reshape    display  (  exit)
+    void mainLoop(void (*display)(), void (*reshape)(int, int));
+
+    // ⺻ ӹ۸ PPM(P6)  ( ̹ 񱳿),  ȯ  θ 
+    bool saveFramebuffer(const char* path);
+}
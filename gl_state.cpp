@@ -0,0 +1,138 @@
+#include "gl_state.h"
+
+#include <GL/glew.h>
+
+namespace GLState {
+
+    static const int MAX_TEXTURE_UNITS = 16;
+    static const GLuint UNKNOWN = 0xFFFFFFFFu; //  𸣴  ( ȣ  )
+
+    static GLuint g_program = UNKNOWN;
+    static GLuint g_vao = UNKNOWN;
+    static GLenum g_activeUnit = UNKNOWN;
+    static GLuint g_texture2D[MAX_TEXTURE_UNITS];  // ֺ GL_TEXTURE_2D ε
+    static bool g_texturesInitialized = false;
+
+    static Stats g_frame = {};     //   ִ 
+    static Stats g_lastFrame = {}; //   (ǥÿ)
+    static Stats g_total = {};
+
+    static void resetTextures() {
+        for (int i = 0; i < MAX_TEXTURE_UNITS; ++i) g_texture2D[i] = UNKNOWN;
+        g_texturesInitialized = true;
+    }
+
+    //  Ȱ  ȣ (𸣸 -1)
+    static int currentUnitIndex() {
+        if (g_activeUnit == UNKNOWN) return -1;
+        int index = (int)(g_activeUnit - GL_TEXTURE0);
+        return (index >= 0 && index < MAX_TEXTURE_UNITS) ? index : -1;
+    }
+
+    void useProgram(GLuint program) {
+        if (program == g_program) {
+            g_frame.skippedPrograms++;
+            g_total.skippedPrograms++;
+            return;
+        }
+        glUseProgram(program);
+        g_program = program;
+        g_frame.issued++;
+        g_total.issued++;
+    }
+
+    void bindVertexArray(GLuint vao) {
+        if (vao == g_vao) {
+            g_frame.skippedVAOs++;
+            g_total.skippedVAOs++;
+            return;
+        }
+        glBindVertexArray(vao);
+        g_vao = vao;
+        g_frame.issued++;
+        g_total.issued++;
+    }
+
+    void activeTexture(GLenum unit) {
+        if (unit == g_activeUnit) {
+            g_frame.skippedActive++;
+            g_total.skippedActive++;
+            return;
+        }
+        glActiveTexture(unit);
+        g_activeUnit = unit;
+        g_frame.issued++;
+        g_total.issued++;
+    }
+
+    void bindTexture(GLenum target, GLuint texture) {
+        if (!g_texturesInitialized) resetTextures();
+
+        // GL_TEXTURE_2D  (ٸ Ÿ ״ )
+        int unit = currentUnitIndex();
+        if (target == GL_TEXTURE_2D && unit >= 0 && g_texture2D[unit] == texture) {
+            g_frame.skippedTextures++;
+            g_total.skippedTextures++;
+            return;
+        }
+        glBindTexture(target, texture);
+        if (target == GL_TEXTURE_2D && unit >= 0) g_texture2D[unit] = texture;
+        g_frame.issued++;
+        g_total.issued++;
+    }
+
+    void countUniform(bool skipped) {
+        if (skipped) {
+            g_frame.skippedUniforms++;
+            g_total.skippedUniforms++;
+        }
+        else {
+            g_frame.issued++;
+            g_total.issued++;
+        }
+    }
+
+    void countDraw(unsigned long long triangles) {
+        g_frame.drawCalls++;
+        g_frame.triangles += triangles;
+        g_total.drawCalls++;
+        g_total.triangles += triangles;
+    }
+
+    void forgetProgram(GLuint program) {
+        //   α׷  GL   Ƿ 𸣴 · Ӵϴ.
+        if (program == g_program) g_program = UNKNOWN;
+    }
+
+    void forgetVertexArray(GLuint vao) {
+        // ε VAO  GL 0 ǵϴ.
+        if (vao == g_vao) g_vao = 0;
+    }
+
+    void forgetTexture(GLuint texture) {
+        if (!g_texturesInitialized) resetTextures();
+        // ε ؽó  ش  0 ǵưϴ.
+        for (int i = 0; i < MAX_TEXTURE_UNITS; ++i)
+            if (g_texture2D[i] == texture) g_texture2D[i] = 0;
+    }
+
+    void invalidate() {
+        g_program = UNKNOWN;
+        g_vao = UNKNOWN;
+        g_activeUnit = UNKNOWN;
+        resetTextures();
+    }
+
+    void beginFrame() {
+        g_lastFrame = g_frame;
+        g_frame = Stats();
+    }
+
+    const Stats& getFrameStats() {
+        return g_lastFrame;
+    }
+
+    const Stats& getTotalStats() {
+        return g_total;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <GL/glew.h>
+
+// GL  ĳ
+//  ε α׷/VAO/ؽó /ؽó  ΰ
+//   ٽ  ̹ ȣ մϴ.
+// ĳð ߳ ʵ ε   Լ ľ մϴ.
+namespace GLState {
+    // / ȣ  (  + )
+    struct Stats {
+        unsigned int issued;           //  GL  ȣ
+        unsigned int skippedPrograms;  //  glUseProgram
+        unsigned int skippedVAOs;      //  glBindVertexArray
+        unsigned int skippedActive;    //  glActiveTexture
+        unsigned int skippedTextures;  //  glBindTexture
+        unsigned int skippedUniforms;  //  glUniform*
+        unsigned int drawCalls;        // ׸  (countDraw , issued  )
+        unsigned long long triangles;  // ׸ ﰢ  (νϽ )
+
+        unsigned int skipped() const {
+            return skippedPrograms + skippedVAOs + skippedActive + skippedTextures + skippedUniforms;
+        }
+    };
+
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint vao);
+    void activeTexture(GLenum unit);                 // GL_TEXTURE0 + n
+    void bindTexture(GLenum target, GLuint texture); //  Ȱ ֿ ε
+
+    // uniform  ĳô ShaderProgram  ְ,   մϴ.
+    void countUniform(bool skipped);
+    // draw call ϳ (glDraw*, UI glBegin/glEnd  , Ʈ  ϳ,  ػ blit)
+    // RenderQueue/DebugDraw/UIManager/DynamicResolution ׸  , //blit triangles = 0
+    void countDraw(unsigned long long triangles);
+
+    //  ̸ GL ٽ   Ƿ ĳÿ ϴ.
+    void forgetProgram(GLuint program);
+    void forgetVertexArray(GLuint vao);
+    void forgetTexture(GLuint texture);
+
+    // ĳø ġ ʰ ¸ ٲ (ܺ ̺귯 ) ȣϸ  ε  ˴ϴ.
+    void invalidate();
+
+    //   ۿ ȣ:   踦 ϰ  ϴ.
+    void beginFrame();
+    const Stats& getFrameStats();   //  
+    const Stats& getTotalStats();   // α׷ ۺ 
+}
@@ -0,0 +1,247 @@
+#include "gpu_profiler.h"
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+
+#include <GL/glew.h>
+
+namespace GpuProfiler {
+
+    static const int MAX_SEGMENTS = 64;   // Ӵ ִ   (ġ    )
+    static const int MAX_DEPTH = 8;       //  ø 
+
+    //  ϳ =  ϳ   
+    struct Segment {
+        int pass;
+        GLuint query;
+    };
+
+    struct FrameSlot {
+        GLuint queries[MAX_SEGMENTS];
+        Segment segments[MAX_SEGMENTS];
+        int segmentCount;
+        bool pending;     //    
+    };
+
+    struct Pass {
+        std::string name;
+        const char* key;                 // begin Ѿ  ( 񱳿)
+        float samples[SAMPLE_WINDOW];    // Ӻ հ (ms)
+        int sampleCount;
+        int sampleHead;
+        float frameMs;                   //  д ӿ  
+        bool seen;
+    };
+
+    static bool g_available = false;
+    static FrameSlot g_slots[FRAME_LATENCY];
+    static int g_frame = -1;
+    static std::vector<Pass> g_passes;
+    static int g_stack[MAX_DEPTH];        //   (pass ȣ)
+    static int g_depth = 0;
+    static bool g_queryActive = false;    //  GL_TIME_ELAPSED   ִ
+    static int g_dropped = 0;
+    static float g_frameSamples[SAMPLE_WINDOW];
+    static int g_frameSampleCount = 0;
+    static int g_frameSampleHead = 0;
+    static ResultListener g_listener = nullptr;
+
+    static int findPass(const char* name) {
+        for (size_t i = 0; i < g_passes.size(); ++i)
+            if (g_passes[i].key == name || g_passes[i].name == name) return (int)i;
+
+        Pass pass;
+        pass.name = name;
+        pass.key = name;
+        pass.sampleCount = 0;
+        pass.sampleHead = 0;
+        pass.frameMs = 0.0f;
+        pass.seen = false;
+        g_passes.push_back(pass);
+        return (int)g_passes.size() - 1;
+    }
+
+    //   ĭ pass    
+    static void openSegment(int pass) {
+        FrameSlot& slot = g_slots[g_frame % FRAME_LATENCY];
+        if (slot.segmentCount >= MAX_SEGMENTS) return;
+        Segment& seg = slot.segments[slot.segmentCount];
+        seg.pass = pass;
+        seg.query = slot.queries[slot.segmentCount];
+        slot.segmentCount++;
+        glBeginQuery(GL_TIME_ELAPSED, seg.query);
+        g_queryActive = true;
+    }
+
+    static void closeSegment() {
+        if (!g_queryActive) return;
+        glEndQuery(GL_TIME_ELAPSED);
+        g_queryActive = false;
+    }
+
+    static void pushSample(float* samples, int& count, int& head, float value) {
+        samples[head] = value;
+        head = (head + 1) % SAMPLE_WINDOW;
+        if (count < SAMPLE_WINDOW) count++;
+    }
+
+    // FRAME_LATENCY   ĭ б (    ͵   )
+    static void collect(FrameSlot& slot) {
+        if (!slot.pending) return;
+        slot.pending = false;
+        if (slot.segmentCount == 0) return;
+
+        GLint available = 0;
+        glGetQueryObjectiv(slot.segments[slot.segmentCount - 1].query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            g_dropped++;   // ٸ ʰ 
+            return;
+        }
+
+        for (auto& pass : g_passes) {
+            pass.frameMs = 0.0f;
+            pass.seen = false;
+        }
+        float total = 0.0f;
+        for (int i = 0; i < slot.segmentCount; ++i) {
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(slot.segments[i].query, GL_QUERY_RESULT, &ns);
+            float ms = (float)(ns / 1.0e6);
+            Pass& pass = g_passes[slot.segments[i].pass];
+            pass.frameMs += ms;
+            pass.seen = true;
+            total += ms;
+        }
+        for (auto& pass : g_passes) {
+            if (!pass.seen) continue;
+            pushSample(pass.samples, pass.sampleCount, pass.sampleHead, pass.frameMs);
+            if (g_listener) g_listener(pass.name.c_str(), pass.frameMs);
+        }
+        pushSample(g_frameSamples, g_frameSampleCount, g_frameSampleHead, total);
+        if (g_listener) g_listener(nullptr, total);
+    }
+
+    bool init() {
+        g_available = (GLEW_VERSION_3_3 || GLEW_ARB_timer_query) ? true : false;
+        if (!g_available) {
+            std::cout << "[GPU Ϸ] Ÿ̸   ʾ  " << std::endl;
+            return false;
+        }
+        for (auto& slot : g_slots) {
+            glGenQueries(MAX_SEGMENTS, slot.queries);
+            slot.segmentCount = 0;
+            slot.pending = false;
+        }
+        g_frame = -1;
+        g_depth = 0;
+        g_queryActive = false;
+        return true;
+    }
+
+    void cleanup() {
+        if (!g_available) return;
+        closeSegment();
+        for (auto& slot : g_slots) {
+            glDeleteQueries(MAX_SEGMENTS, slot.queries);
+            slot.segmentCount = 0;
+            slot.pending = false;
+        }
+        g_available = false;
+    }
+
+    void beginFrame() {
+        if (!g_available) return;
+        //  ӿ    ⼭ 
+        closeSegment();
+        g_depth = 0;
+
+        g_frame++;
+        FrameSlot& slot = g_slots[g_frame % FRAME_LATENCY];
+        collect(slot);
+        slot.segmentCount = 0;
+        slot.pending = true;
+    }
+
+    void begin(const char* name) {
+        if (!g_available || g_frame < 0) return;
+        if (g_depth >= MAX_DEPTH) {
+            g_depth++;   // ̸    (end ¦ ߱)
+            return;
+        }
+        closeSegment();   // ٱ   
+        int pass = findPass(name);
+        g_stack[g_depth++] = pass;
+        openSegment(pass);
+    }
+
+    void end() {
+        if (!g_available || g_depth == 0) return;
+        g_depth--;
+        if (g_depth >= MAX_DEPTH) return;
+        closeSegment();
+        if (g_depth > 0) openSegment(g_stack[g_depth - 1]);   // ٱ  ̾ 
+    }
+
+    bool inScope() {
+        return g_depth > 0;
+    }
+
+    // ֱ  / (   )
+    static void computeStats(const float* samples, int count, int head, PassStats& out) {
+        out.samples = count;
+        out.lastMs = out.avgMs = out.p50Ms = out.p95Ms = out.p99Ms = out.maxMs = 0.0f;
+        if (count == 0) return;
+
+        std::vector<float> sorted(samples, samples + count);
+        std::sort(sorted.begin(), sorted.end());
+        float sum = 0.0f;
+        for (float v : sorted) sum += v;
+        auto percentile = [&](float p) {
+            int i = (int)(p * (count - 1) + 0.5f);
+            return sorted[std::min(count - 1, std::max(0, i))];
+        };
+        out.lastMs = samples[(head + SAMPLE_WINDOW - 1) % SAMPLE_WINDOW];
+        out.avgMs = sum / count;
+        out.p50Ms = percentile(0.50f);
+        out.p95Ms = percentile(0.95f);
+        out.p99Ms = percentile(0.99f);
+        out.maxMs = sorted.back();
+    }
+
+    int getPassCount() {
+        return (int)g_passes.size();
+    }
+
+    bool getPassStats(int index, PassStats& out) {
+        if (index < 0 || index >= (int)g_passes.size()) return false;
+        const Pass& pass = g_passes[index];
+        out.name = pass.name;
+        computeStats(pass.samples, pass.sampleCount, pass.sampleHead, out);
+        return true;
+    }
+
+    bool getPassStats(const char* name, PassStats& out) {
+        for (size_t i = 0; i < g_passes.size(); ++i)
+            if (g_passes[i].name == name) return getPassStats((int)i, out);
+        return false;
+    }
+
+    float getFrameMs() {
+        PassStats stats;
+        computeStats(g_frameSamples, g_frameSampleCount, g_frameSampleHead, stats);
+        return stats.avgMs;
+    }
+
+    int getDroppedFrames() {
+        return g_dropped;
+    }
+
+    bool isAvailable() {
+        return g_available;
+    }
+
+    void setResultListener(ResultListener listener) {
+        g_listener = listener;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+#include <GL/glew.h>
+
+// GPU  Ϸ (GL_TIME_ELAPSED )
+// ̸    ɰ,  FRAME_LATENCY  ڿ   нϴ.
+//        ٸ Ƿ   ʽϴ.
+// GL_TIME_ELAPSED ĥ  ,  ȿ ٸ   ٱ   ٰ
+//     ̾ ϴ (=  ڱ ð,  ̸  ȿ ջ).
+// RenderQueue::flush ٱ     Ŷ profileScope  ڵ ϴ.
+namespace GpuProfiler {
+    static const int FRAME_LATENCY = 4;       //     (̸ŭ ʰ )
+    static const int SAMPLE_WINDOW = 240;     // 迡  ֱ  
+
+    //  ϳ ֱ SAMPLE_WINDOW   (ms)
+    struct PassStats {
+        std::string name;
+        float lastMs;
+        float avgMs;
+        float p50Ms;
+        float p95Ms;
+        float p99Ms;
+        float maxMs;
+        int samples;
+    };
+
+    bool init();       // Ÿ̸   false ( ȣ  ƹ͵  )
+    void cleanup();
+
+    //  :  FRAME_LATENCY    а ̹  ĭ 
+    void beginFrame();
+
+    //  / (name α׷    ִ ڿ,  ͷ)
+    void begin(const char* name);
+    void end();
+    bool inScope();    //   ִ
+
+    //   
+    struct Scope {
+        explicit Scope(const char* name) { begin(name); }
+        ~Scope() { end(); }
+    };
+
+    // ġũ/̿ ȸ
+    int getPassCount();
+    bool getPassStats(int index, PassStats& out);
+    bool getPassStats(const char* name, PassStats& out);
+    float getFrameMs();          // ֱ  ü   
+    int getDroppedFrames();      //  ʾ   
+    bool isAvailable();
+
+    //     Ҹ:  ӿ    ,  name == nullptr  հ
+    // (SAMPLE_WINDOW   ü ƾ ϴ ġũ, nullptr̸ )
+    typedef void (*ResultListener)(const char* name, float ms);
+    void setResultListener(ResultListener listener);
+}
@@ -0,0 +1,194 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "world.h"
+#include "character_sim.h"
+#include "octopus_sim.h"
+#include "replay.h"
+#include "cpu_profiler.h"
+
+// 帮 ùķ̼   (â/GL )
+// World::step    ʰ  ڽ  ð ξ  ޸ϴ.
+// ڽ(Course  , ÷ , غ/) Ӱ  World ڵ̹Ƿ ͳ ̵  Դϴ.
+// 뷱 (õ带 ٲ   ) ÷   ӽ ȸ Ȯο
+//
+// : Headless_Sim [--runs N] [--seed S] [--distance M] [--max-seconds S] [--script ]
+//                      [--record  | --replay ] [--check-interval N]
+// ũƮ:  ٿ " Ű" (Ű U D L R J , '-' ƹ͵  , '#' ϸ ּ)
+//    ð   ð  Ű  ְ, J   ð   
+//   ũƮ  ó   ȭǥ 
+//  ڽ õ尡 seed +  ȣ (  Ӱ  Course Ģ̹Ƿ 뷱   ڽ ״)
+// --record ù  Է, --replay ȭ  õ Է    üũ 
+//   (ӿ --record ϵ ״ , ̸ --distance  ȭ ڽ )
+
+static const float READY_SECONDS = World::READY_STEPS * World::STEP_DT;
+
+struct ScriptLine {
+    float time;
+    SimInput input;
+};
+
+static bool loadScript(const char* path, std::vector<ScriptLine>& out) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        fprintf(stderr, "[帮] ũƮ   ϴ: %s\n", path);
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        ScriptLine entry = {};
+        std::string keys;
+        if (!(ss >> entry.time >> keys)) continue;
+        for (char c : keys) {
+            switch (c) {
+            case 'U': case 'u': entry.input.up = true; break;
+            case 'D': case 'd': entry.input.down = true; break;
+            case 'L': case 'l': entry.input.left = true; break;
+            case 'R': case 'r': entry.input.right = true; break;
+            case 'J': case 'j': entry.input.jump = true; break;
+            }
+        }
+        out.push_back(entry);
+    }
+    return true;
+}
+
+struct RunResult {
+    float distance;     //  Ÿ (m)
+    float seconds;      //   ùķ̼ ð (غ ð )
+    unsigned long long steps;
+    int stuns;
+    bool finished;
+    double wallMs;      //  ɸ ð
+};
+
+//  ϳ: غ ð ->  Ǵ ִ ð ( SimulationStep  )
+static RunResult runOnce(const std::vector<ScriptLine>& script, unsigned int seed, float distance, float maxSeconds) {
+    RunResult result = {};
+    auto start = std::chrono::steady_clock::now();
+
+    World::startRun(seed, distance);
+
+    SimInput held = {};
+    held.up = true;   // ũƮ   
+    size_t next = 0;
+    bool wasStunned = false;
+    while (World::getPhase() != World::PHASE_FINISHED && World::getRunTime() < maxSeconds) {
+        // Է  Ŀ (ũƮ ð  )
+        SimInput input = {};
+        if (World::getPhase() == World::PHASE_PLAYING) {
+            float t = World::getRunTime();
+            input = held;
+            input.jump = false;
+            // ̹  ð  ũƮ   (J  ܿ)
+            while (next < script.size() && script[next].time <= t) {
+                held = script[next].input;
+                held.jump = false;
+                input = script[next].input;
+                next++;
+            }
+        }
+
+        input = Replay::nextInput(input);
+        World::step(input);
+        Replay::endStep(World::checksum);
+        result.steps++;
+        if (Replay::isPlaybackDone()) break;   // ȭ   (   ̳  ڽ)
+
+        bool stunned = Character::isStunned();
+        if (stunned && !wasStunned) result.stuns++;
+        wasStunned = stunned;
+    }
+
+    result.distance = World::getDistance();
+    result.seconds = World::getRunTime();
+    result.finished = World::getPhase() == World::PHASE_FINISHED;
+
+    result.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+int main(int argc, char** argv) {
+    PROFILE_THREAD("headless");
+    int runs = 1;
+    unsigned int seed = 1;
+    float distance = 800.0f;      //  ⺻ ڽ 
+    float maxSeconds = 600.0f;
+    const char* scriptPath = nullptr;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    int checkInterval = Replay::DEFAULT_CHECK_INTERVAL;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc) seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--distance" && i + 1 < argc) distance = (float)atof(argv[++i]);
+        else if (arg == "--max-seconds" && i + 1 < argc) maxSeconds = (float)atof(argv[++i]);
+        else if (arg == "--script" && i + 1 < argc) scriptPath = argv[++i];
+        else if (arg == "--record" && i + 1 < argc) recordPath = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc) replayPath = argv[++i];
+        else if (arg == "--check-interval" && i + 1 < argc) checkInterval = atoi(argv[++i]);
+        else {
+            fprintf(stderr, ": %s [--runs N] [--seed S] [--distance M] [--max-seconds S] [--script ]"
+                " [--record  | --replay ] [--check-interval N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<ScriptLine> script;
+    if (scriptPath && !loadScript(scriptPath, script)) return 1;
+
+    // ȭ/   (̸ õ ڽ ̵  )
+    if (replayPath) {
+        if (!Replay::startPlayback(replayPath)) return 1;
+        seed = Replay::getSeed();
+        distance = Replay::getCourseLength();
+        runs = 1;
+    }
+    else if (recordPath) {
+        Replay::startRecording(recordPath, seed, distance, checkInterval);
+        runs = 1;
+    }
+
+    int finishedRuns = 0;
+    double totalSeconds = 0.0, totalWallMs = 0.0;
+    unsigned long long totalSteps = 0;
+    for (int run = 0; run < runs; ++run) {
+        RunResult r = runOnce(script, seed + run, distance, maxSeconds);
+        printf("run %d (seed %u): %s %.1fm in %.2fs, %llu steps, stuns %d, wall %.2fms (%.0fx realtime)\n",
+            run, seed + run, r.finished ? "finished" : "stopped at", r.distance, r.seconds,
+            r.steps, r.stuns, r.wallMs, r.wallMs > 0.0 ? (r.seconds + READY_SECONDS) * 1000.0 / r.wallMs : 0.0);
+        if (r.finished) {
+            finishedRuns++;
+            totalSeconds += r.seconds;
+        }
+        totalWallMs += r.wallMs;
+        totalSteps += r.steps;
+    }
+
+    // ȭ  /   (Replay ü α׿  ũƮ б   )
+    bool replayOk = true;
+    if (Replay::isPlaying()) {
+        if (Replay::hasDiverged()) printf("replay: diverged at step %llu\n", Replay::getDivergedTick());
+        else printf("replay: matched %llu steps\n", Replay::getTick());
+    }
+    if (Replay::isPlaying() || Replay::isRecording()) {
+        replayOk = Replay::finish();
+        if (recordPath && replayOk) printf("recorded: %s\n", recordPath);
+    }
+
+    printf("summary: %d/%d finished", finishedRuns, runs);
+    if (finishedRuns > 0) printf(", average %.2fs", totalSeconds / finishedRuns);
+    printf(", %llu steps in %.1fms (%.2fus/step)\n",
+        totalSteps, totalWallMs, totalSteps > 0 ? totalWallMs * 1000.0 / totalSteps : 0.0);
+    return (finishedRuns == runs && replayOk) ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+#include "light_grid.h"
+#include "gl_state.h"
+#include "cpu_profiler.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+namespace LightGrid {
+
+    static const int CLUSTER_COUNT = TILES_X * TILES_Y * SLICES;
+    static const int MAX_INDICES = CLUSTER_COUNT * MAX_LIGHTS_PER_CLUSTER;
+
+    struct PointLight {
+        glm::vec3 position;
+        float radius;
+        glm::vec3 color;
+        float pad;
+    };
+
+    // ؽó  ( + ؽó )
+    struct BufferTexture {
+        GLuint buffer = 0;
+        GLuint texture = 0;
+    };
+
+    static BufferTexture g_lightData;    // RGBA32F,  2ؼ (ġ+ݰ, )
+    static BufferTexture g_clusterGrid;  // RG32UI, Ŭ͸ ( ġ, )
+    static BufferTexture g_lightIndices; // R32UI, Ŭ   ȣ
+
+    static std::vector<PointLight> g_lights;
+    static std::vector<unsigned int> g_grid;      // CLUSTER_COUNT * 2
+    static std::vector<unsigned int> g_indices;
+    static std::vector<int> g_lightRanges;        //  [x0, x1, y0, y1, z0, z1] (-1̸  )
+
+    static int g_indexCount = 0;
+    static int g_maxClusterLights = 0;
+
+    static bool createBufferTexture(BufferTexture& bt, GLenum internalFormat, GLsizeiptr size) {
+        glGenBuffers(1, &bt.buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, bt.buffer);
+        glBufferData(GL_TEXTURE_BUFFER, size, NULL, GL_STREAM_DRAW);
+        glGenTextures(1, &bt.texture);
+        GLState::bindTexture(GL_TEXTURE_BUFFER, bt.texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, internalFormat, bt.buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        return bt.buffer != 0 && bt.texture != 0;
+    }
+
+    static void destroyBufferTexture(BufferTexture& bt) {
+        if (bt.texture) {
+            GLState::forgetTexture(bt.texture);
+            glDeleteTextures(1, &bt.texture);
+        }
+        if (bt.buffer) glDeleteBuffers(1, &bt.buffer);
+        bt.texture = 0;
+        bt.buffer = 0;
+    }
+
+    //   ȭ  պκи 
+    static void upload(const BufferTexture& bt, GLsizeiptr capacity, const void* data, GLsizeiptr size) {
+        glBindBuffer(GL_TEXTURE_BUFFER, bt.buffer);
+        glBufferData(GL_TEXTURE_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+        if (size > 0) glBufferSubData(GL_TEXTURE_BUFFER, 0, size, data);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    bool init() {
+        GLState::activeTexture(GL_TEXTURE0 + LIGHT_DATA_UNIT);
+        bool ok = createBufferTexture(g_lightData, GL_RGBA32F, MAX_LIGHTS * sizeof(PointLight));
+        GLState::activeTexture(GL_TEXTURE0 + CLUSTER_GRID_UNIT);
+        ok = createBufferTexture(g_clusterGrid, GL_RG32UI, CLUSTER_COUNT * 2 * sizeof(unsigned int)) && ok;
+        GLState::activeTexture(GL_TEXTURE0 + LIGHT_INDEX_UNIT);
+        ok = createBufferTexture(g_lightIndices, GL_R32UI, MAX_INDICES * sizeof(unsigned int)) && ok;
+        GLState::activeTexture(GL_TEXTURE0);
+
+        g_lights.reserve(MAX_LIGHTS);
+        g_grid.assign(CLUSTER_COUNT * 2, 0);
+        g_indices.reserve(MAX_INDICES);
+        if (!ok) cleanup();
+        return ok;
+    }
+
+    void cleanup() {
+        destroyBufferTexture(g_lightData);
+        destroyBufferTexture(g_clusterGrid);
+        destroyBufferTexture(g_lightIndices);
+    }
+
+    void begin() {
+        g_lights.clear();
+    }
+
+    void addPointLight(const glm::vec3& position, const glm::vec3& color, float radius) {
+        if ((int)g_lights.size() >= MAX_LIGHTS || radius <= 0.0f) return;
+        PointLight light;
+        light.position = position;
+        light.radius = radius;
+        light.color = color;
+        light.pad = 0.0f;
+        g_lights.push_back(light);
+    }
+
+    static int clampInt(int v, int lo, int hi) {
+        return v < lo ? lo : (v > hi ? hi : v);
+    }
+
+    void build(const glm::mat4& view, float fovY, float aspect, float nearZ, float farZ,
+               int viewportW, int viewportH, CameraBlock& camera) {
+        PROFILE_ZONE("LightGrid::build");
+        const float tanY = std::tan(fovY * 0.5f);
+        const float tanX = tanY * aspect;
+        const float logNear = std::log(nearZ);
+        const float sliceScale = (float)SLICES / std::log(farZ / nearZ);
+
+        // 1)  ġ Ŭ  ( δ  )
+        int lightCount = (int)g_lights.size();
+        g_lightRanges.assign(lightCount * 6, -1);
+        std::vector<unsigned int> counts(CLUSTER_COUNT, 0);
+        for (int i = 0; i < lightCount; ++i) {
+            const PointLight& light = g_lights[i];
+            glm::vec3 p = glm::vec3(view * glm::vec4(light.position, 1.0f));
+            float depth = -p.z;   // ī޶  +
+            float zMin = depth - light.radius, zMax = depth + light.radius;
+            if (zMax < nearZ || zMin > farZ) continue;
+            zMin = std::max(zMin, nearZ);
+            zMax = std::min(zMax, farZ);
+
+            // x/d d  ̹Ƿ      
+            float xLo = std::min((p.x - light.radius) / zMin, (p.x - light.radius) / zMax) / tanX;
+            float xHi = std::max((p.x + light.radius) / zMin, (p.x + light.radius) / zMax) / tanX;
+            float yLo = std::min((p.y - light.radius) / zMin, (p.y - light.radius) / zMax) / tanY;
+            float yHi = std::max((p.y + light.radius) / zMin, (p.y + light.radius) / zMax) / tanY;
+            if (xHi < -1.0f || xLo > 1.0f || yHi < -1.0f || yLo > 1.0f) continue;
+
+            int* r = &g_lightRanges[i * 6];
+            r[0] = clampInt((int)std::floor((xLo * 0.5f + 0.5f) * TILES_X), 0, TILES_X - 1);
+            r[1] = clampInt((int)std::floor((xHi * 0.5f + 0.5f) * TILES_X), 0, TILES_X - 1);
+            r[2] = clampInt((int)std::floor((yLo * 0.5f + 0.5f) * TILES_Y), 0, TILES_Y - 1);
+            r[3] = clampInt((int)std::floor((yHi * 0.5f + 0.5f) * TILES_Y), 0, TILES_Y - 1);
+            r[4] = clampInt((int)std::floor((std::log(zMin) - logNear) * sliceScale), 0, SLICES - 1);
+            r[5] = clampInt((int)std::floor((std::log(zMax) - logNear) * sliceScale), 0, SLICES - 1);
+
+            for (int z = r[4]; z <= r[5]; ++z)
+                for (int y = r[2]; y <= r[3]; ++y)
+                    for (int x = r[0]; x <= r[1]; ++x)
+                        counts[(z * TILES_Y + y) * TILES_X + x]++;
+        }
+
+        // 2) Ŭͺ  ġ ( MAX_LIGHTS_PER_CLUSTER ڸ)
+        unsigned int offset = 0;
+        g_maxClusterLights = 0;
+        for (int c = 0; c < CLUSTER_COUNT; ++c) {
+            unsigned int n = std::min(counts[c], (unsigned int)MAX_LIGHTS_PER_CLUSTER);
+            g_grid[c * 2] = offset;
+            g_grid[c * 2 + 1] = 0;
+            offset += n;
+            if ((int)n > g_maxClusterLights) g_maxClusterLights = (int)n;
+        }
+        g_indexCount = (int)offset;
+
+        // 3)  ȣ ä
+        g_indices.assign(offset, 0);
+        for (int i = 0; i < lightCount; ++i) {
+            const int* r = &g_lightRanges[i * 6];
+            if (r[0] < 0) continue;
+            for (int z = r[4]; z <= r[5]; ++z)
+                for (int y = r[2]; y <= r[3]; ++y)
+                    for (int x = r[0]; x <= r[1]; ++x) {
+                        int c = (z * TILES_Y + y) * TILES_X + x;
+                        unsigned int& n = g_grid[c * 2 + 1];
+                        if (n >= (unsigned int)MAX_LIGHTS_PER_CLUSTER) continue;
+                        g_indices[g_grid[c * 2] + n] = (unsigned int)i;
+                        n++;
+                    }
+        }
+
+        upload(g_lightData, MAX_LIGHTS * sizeof(PointLight), g_lights.data(), lightCount * sizeof(PointLight));
+        upload(g_clusterGrid, CLUSTER_COUNT * 2 * sizeof(unsigned int), g_grid.data(), CLUSTER_COUNT * 2 * sizeof(unsigned int));
+        upload(g_lightIndices, MAX_INDICES * sizeof(unsigned int), g_indices.data(), g_indices.size() * sizeof(unsigned int));
+
+        // ̴: tile = gl_FragCoord / clusterScale.xy, slice = log(depth) * clusterScale.z + clusterScale.w
+        camera.clusterScale = glm::vec4((float)viewportW / TILES_X, (float)viewportH / TILES_Y, sliceScale, -logNear * sliceScale);
+        camera.clusterInfo = glm::vec4(lightCount > 0 ? 1.0f : 0.0f, (float)TILES_X, (float)TILES_Y, (float)SLICES);
+    }
+
+    void disable(CameraBlock& camera) {
+        camera.clusterInfo.x = 0.0f;
+    }
+
+    int getLightCount() {
+        return (int)g_lights.size();
+    }
+
+    int getIndexCount() {
+        return g_indexCount;
+    }
+
+    int getMaxClusterLights() {
+        return g_maxClusterLights;
+    }
+}
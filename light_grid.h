@@ -0,0 +1,38 @@
+#pragma once
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "shader_program.h"
+
+// Ŭ  
+// ͳ ,      CPU   (ȭ Ÿ x  )  
+// ؽó  3(  / Ŭͺ  /  ȣ ) øϴ.
+// ׸Ʈ ̴(LIT ) ڱ ŬͿ ģ  ϹǷ
+//  ü   ƴ϶  ڸ  е մϴ.
+// (ĳ͸ ٴϴ   ó Camera  lightPos/lightColor)
+namespace LightGrid {
+    static const int TILES_X = 16;
+    static const int TILES_Y = 9;
+    static const int SLICES = 24;                 //   (near~far  )
+    static const int MAX_LIGHTS = 1024;           // Ӵ ִ  
+    static const int MAX_LIGHTS_PER_CLUSTER = 32; // ġ  
+
+    bool init();
+    void cleanup();
+
+    //  :   
+    void begin();
+    //  ǥ  (radius  0 )
+    void addPointLight(const glm::vec3& position, const glm::vec3& color, float radius);
+
+    //  ŬͿ  ؽó ۷ ø, camera clusterScale/clusterInfo ä
+    // (camera  CameraUBO::update ÷ )
+    void build(const glm::mat4& view, float fovY, float aspect, float nearZ, float farZ,
+               int viewportW, int viewportH, CameraBlock& camera);
+
+    //  信 Ŭ   (ʻȭ  ڿ ȭ ũⰡ ٸ )
+    void disable(CameraBlock& camera);
+
+    int getLightCount();         //  build  
+    int getIndexCount();         //  build (Ŭ, )  
+    int getMaxClusterLights();   //  build  պ Ŭ  
+}
@@ -10,42 +10,38 @@
 #include <chrono>
 #include <cstdio>
 
-#include <gl/glew.h>
-#include <gl/freeglut.h>
-#include <gl/freeglut_ext.h>
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+#include <GL/freeglut_ext.h>
 
-#include <gl/glm/glm.hpp>
-#include <gl/glm/ext.hpp>
-#include <gl/glm/gtc/matrix_transform.hpp>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 #include "character.h"
 #include "octopus.h"
 #include "stb_image.h"
 #include "UI_manager.h"
+#include "tunnel.h"
+#include "shader_program.h"
+#include "gl_state.h"
+#include "render_queue.h"
+#include "debug_draw.h"
+#include "portrait.h"
+#include "texture_cache.h"
+#include "asset_loader.h"
+#include "program_cache.h"
+#include "light_grid.h"
+#include "dynamic_resolution.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+#include "world.h"
+#include "replay.h"
+#include "benchmark.h"
+#include "gl_context.h"
 
 #define MAX_LINE_LENGTH 256
 
-char* filetobuf(const char* file)
-{
-	FILE* fptr;
-	long length;
-	char* buf;
-	fptr = fopen(file, "rb");
-	if (!fptr)
-		return NULL;
-	fseek(fptr, 0, SEEK_END);
-	length = ftell(fptr);
-	buf = (char*)malloc(length + 1);
-	fseek(fptr, 0, SEEK_SET);
-	fread(buf, length, 1, fptr);
-	fclose(fptr);
-	buf[length] = 0;
-	return buf;
-}
-
-void make_vertexShaders();
-void make_fragmentShaders();
-GLuint make_shaderProgram();
 GLvoid drawScene();
 GLvoid Reshape(int w, int h);
 GLvoid keyboard(unsigned char key, int x, int y);
@@ -53,13 +49,12 @@ GLvoid keyboardUp(unsigned char key, int x, int y);  // Ű 
 GLvoid specialKeyboard(int key, int x, int y);
 GLvoid specialKeyboardUp(int key, int x, int y);  // ƯŰ  Լ
 GLvoid timer(int value);
+GLvoid idle();
 
 
 GLint width, height;
-GLuint shaderProgramID, g_wallTextureID, g_titleTextureID;
-GLuint LoadTexture(const char* filename);
-GLuint vertexShader;
-GLuint fragmentShader;
+ShaderVariants g_mainShaders;  // acting3_* ̴  (#define ո   )
+GLuint g_wallTextureID, g_titleTextureID;
 GLuint tVAO = 0, tVBO = 0;
 GLuint VAO, VBO;
 
@@ -78,8 +73,18 @@ float cameraOrbitRadius = 5.0f;
 static const float CAMERA_SIDE_OFFSET = 0.0f;   // ĳ   (¿)
 static const float CAMERA_BACK_DISTANCE = 7.0f; // ĳ  Ÿ
 static const float CAMERA_HEIGHT = 5.5f;        // ĳ  
-static const float CAMERA_FOLLOW_SPEED = 0.2f; // ī޶ 󰡴 ӵ (ε巯)
+static const float CAMERA_FOLLOW_SPEED = 0.2f; // ī޶ 󰡴 ӵ (ε巯, 60Hz   )
 static const float CAMERA_TARGET_HEIGHT = 0.0f; // ī޶ ٶ󺸴 
+static const float CAMERA_FOV_Y = 45.0f;        //  þ߰ ()
+static const float CAMERA_NEAR = 0.1f;
+static const float CAMERA_FAR = 100.0f;         // DrawSurvivalMap þ ( 100m) 
+
+//   ùķ̼: Է///ī޶ World::STEP_DT θ ϰ
+// ȭ    ̸ ؼ ׸ ( ӵ ޶  )
+static const float MAX_FRAME_DT = 0.1f;    //   ƿ͵ ̸ŭ  (ִ 12)
+double g_simAccumulator = 0.0;             //     ð ()
+glm::vec3 g_prevCameraPos = cameraPos;     //   ī޶ ġ ( )
+bool g_uncapped = false;                   // --uncapped: 16ms Ÿ̸Ӹ ٸ ʰ  ׸
 
 // ִϸ̼ 
 bool cameraOrbitAnimation = false;         // ī޶  ִϸ̼
@@ -88,16 +93,62 @@ bool allAnimationsStopped = false;         // 
 //   
 enum GameState { TITLE, READY, PLAYING, FINISHED};
 GameState g_gameState = TITLE;
-float g_totalDistance = 800.0f; // ǥ Ÿ
-float g_currentDistance = 0.0f; //  ̵ Ÿ
-float g_readyTime = 4.0f;    // غ ð
-float g_startTime = 0.0;      //   ð
+float g_totalDistance = 800.0f; // ǥ Ÿ (޸ Ÿ  World::getDistance / getRunTime)
+bool g_endlessMode = false;     // --endless:    ޸  ڽ
+const int PORTRAIT_SIZE = 150;  // ʻȭ ũ (ȼ, FBO  ũ)
+int g_portraitInterval = 2;     // --portrait-interval N: ʻȭ ٽ ׸ ּ  
+const int ASSET_LOADER_THREADS = 2;       // ڻ δ ۾  
+const float ASSET_UPLOAD_BUDGET_MS = 4.0f; // ŸƲ ȭ鿡 Ӹ GL ε忡  ð
+bool g_startRequested = false;  // ε ߿ 's'  ε   
+float g_dynresTargetMs = 16.6f; // --dynres-target MS:  ػ󵵰 ߷  ð
+float g_dynresMinScale = 0.5f;  // --dynres-min S / --dynres-max S:  ػ  
+float g_dynresMaxScale = 1.0f;
+bool g_showGpuProfiler = false; // 'p': GPU  ð ǥ
+float g_traceSeconds = 10.0f;   // --trace-seconds N: 't' ϴ CPU Ʈ̽ 
+unsigned int g_seed = 0;        // --seed N: ڽ õ (     , ⺻ ð, ̸  õ)
+const char* g_recordPath = nullptr;   // --record : ܺ Է° õ带 ȭ (ϰų 'q'   )
+const char* g_replayPath = nullptr;   // --replay : ȭ Է   ٽ  (Ű ̵ Է )
+int g_checkInterval = Replay::DEFAULT_CHECK_INTERVAL;   // --check-interval N: ȭ/ üũ  ()
+
+// --benchmark: ŸƲ  ٷ 800m ڽ  õ ޸(--replay   Է,   )
+// ϸ  踦 --benchmark-out (JSON)  
+// ( ػ󵵵  ػ )
+static const unsigned int BENCHMARK_SEED = 1;
+bool g_benchmark = false;
+const char* g_benchmarkPath = "benchmark.json";
+Benchmark::FrameSample g_benchFrame;      //   (draw    GLState::beginFrame ڿ Ȯ)
+bool g_benchFramePending = false;
+
+// ġũ/ũ: Ӹ ùķ̼  ð ƴ϶ FIXED_FRAME_DTŭ 
+// (谡    ӵ ׸ =  ȣ  ̹  )
+static const float FIXED_FRAME_DT = 1.0f / 60.0f;
+bool g_fixedFrameStep = false;
+
+// --backend window|egl|osmesa, --size WxH: â  ũ ؽƮ ׸ (gl_context.h)
+// ũ Ű尡 Ƿ ε  ٷ ϰ, ġũ 뺻( )̳ --replay Է ޷ ϸ 
+// ( ڽ  Ƿ --frames ־ )
+GLContext::Backend g_backend = GLContext::BACKEND_WINDOW;
+int g_maxFrames = 0;                    // --frames N:   N ׸  (0 =  )
+int g_captureEvery = 0;                 // --capture-every N:   NӸ ȭ PPM 
+const char* g_capturePrefix = "frame_"; // --capture-prefix P:   ̸ պκ (P000120.ppm)
+int g_frameIndex = 0;                   // (StartRun)  ׸  
+
+// ÷ : World ĳ/ ڷ  ī޶ ͳε  ŭ ű
+double g_originOffsetZ = 0.0;   // ī޶/ͳο ݿ  (World::getOriginOffset )
 std::chrono::steady_clock::time_point lastTime;
 
 void InitBuffer();
+void UpdateFloatingOrigin();
+void StartRun();
+void FinishBenchmark();
+void Shutdown(int exitCode);
+void EndFrame();
+void SimulationStep(float dt);
+SimInput ReadInput();
+float SmoothFactor(float perFrame, float dt);
+void DrawGpuProfilerOverlay();
 void UpdateCameraPosition();
 void InitTexture(const char* filename);
-void DrawTexturedCube(GLuint shaderID, glm::mat4 modelMat, glm::vec3 scale);
 
 // Ű  
 static bool keyStates[256] = {false};
@@ -106,246 +157,270 @@ static bool keyStates[256] = {false};
 static const int SPECIAL_KEY_OFFSET = 300;
 static bool specialKeyStates[SPECIAL_KEY_OFFSET] = {false};
 
-void main(int argc, char** argv)
+int main(int argc, char** argv)
 {
+	PROFILE_THREAD("main");
 	width = 1200;
 	height = 800;
-	glutInit(&argc, argv);
-	glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
-	glutInitWindowPosition(100, 100);
-	glutInitWindowSize(width, height);
-	glutCreateWindow("project - Runner");
-	glewExperimental = GL_TRUE;
-	glewInit();
 
-	make_vertexShaders();
-	make_fragmentShaders();
-	shaderProgramID = make_shaderProgram();
-
-	InitBuffer();
-
-	// ĳ ʱȭ (OBJ   )
-	if (!Character::initCharacter("character.obj", shaderProgramID)) {
-		std::cerr << "ĳ ʱȭ " << std::endl;
-		exit(1);
+	//   (鿣 ũ⸦ ˾ƾ ϹǷ ؽƮ , 𸣴 ڴ glutInit )
+	bool seedGiven = false;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "--endless") g_endlessMode = true;
+		else if (std::string(argv[i]) == "--portrait-interval" && i + 1 < argc) g_portraitInterval = atoi(argv[++i]);
+		else if (std::string(argv[i]) == "--no-shader-cache") ProgramCache::setEnabled(false);
+		else if (std::string(argv[i]) == "--dynres-target" && i + 1 < argc) g_dynresTargetMs = (float)atof(argv[++i]);
+		else if (std::string(argv[i]) == "--dynres-min" && i + 1 < argc) g_dynresMinScale = (float)atof(argv[++i]);
+		else if (std::string(argv[i]) == "--dynres-max" && i + 1 < argc) g_dynresMaxScale = (float)atof(argv[++i]);
+		else if (std::string(argv[i]) == "--no-dynres") DynamicResolution::setEnabled(false);
+		else if (std::string(argv[i]) == "--trace-seconds" && i + 1 < argc) g_traceSeconds = (float)atof(argv[++i]);
+		else if (std::string(argv[i]) == "--uncapped") g_uncapped = true;
+		else if (std::string(argv[i]) == "--seed" && i + 1 < argc) { g_seed = (unsigned int)strtoul(argv[++i], nullptr, 10); seedGiven = true; }
+		else if (std::string(argv[i]) == "--record" && i + 1 < argc) g_recordPath = argv[++i];
+		else if (std::string(argv[i]) == "--replay" && i + 1 < argc) g_replayPath = argv[++i];
+		else if (std::string(argv[i]) == "--check-interval" && i + 1 < argc) g_checkInterval = atoi(argv[++i]);
+		else if (std::string(argv[i]) == "--benchmark") g_benchmark = true;
+		else if (std::string(argv[i]) == "--benchmark-out" && i + 1 < argc) g_benchmarkPath = argv[++i];
+		else if (std::string(argv[i]) == "--backend" && i + 1 < argc) {
+			if (!GLContext::parseBackend(argv[++i], g_backend)) {
+				std::cerr << "   鿣: " << argv[i] << " (window, egl, osmesa)" << std::endl;
+				return 1;
+			}
+		}
+		else if (std::string(argv[i]) == "--size" && i + 1 < argc) {
+			int w = 0, h = 0;
+			if (sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+				width = w;
+				height = h;
+			}
+		}
+		else if (std::string(argv[i]) == "--frames" && i + 1 < argc) g_maxFrames = atoi(argv[++i]);
+		else if (std::string(argv[i]) == "--capture-every" && i + 1 < argc) g_captureEvery = atoi(argv[++i]);
+		else if (std::string(argv[i]) == "--capture-prefix" && i + 1 < argc) g_capturePrefix = argv[++i];
 	}
-	// [߰] ŸƲ ̹ ε (ϸ 'title.jpg' ּ)
-	g_titleTextureID = LoadTexture("title.jpg");
-
-	//  ؽó LoadTexture ؼ ε 
-	g_wallTextureID = LoadTexture("MAP_WALL.jpg");
 
-	if (!Enemy::initOctopus("Octopus_1.obj", shaderProgramID)) {
-		std::cerr << " ʱȭ " << std::endl;
-		exit(1);
+	if (!GLContext::create(g_backend, &argc, argv, width, height, "project - Runner")) {
+		std::cerr << "GL ؽƮ ʱȭ  (" << GLContext::getBackendName(g_backend) << ")" << std::endl;
+		return 1;
 	}
-	
-	UIManager::Init();
-	lastTime = std::chrono::steady_clock::now();
-
-
-	glutDisplayFunc(drawScene);
-	glutReshapeFunc(Reshape);
-	glutKeyboardFunc(keyboard);
-	glutKeyboardUpFunc(keyboardUp);  // Ű  ݹ ߰
-	glutSpecialFunc(specialKeyboard);
-	glutSpecialUpFunc(specialKeyboardUp);  // ƯŰ  ݹ ߰
-	glutTimerFunc(16, timer, 0);
-
-	srand((unsigned int)time(NULL));
-
-	std::cout << "=== ĳ ۹ ===" << std::endl;
-	std::cout << "Ű: ĳ XZ  ̵" << std::endl;
-	std::cout << "q: " << std::endl;
 
-	glutMainLoop();
-}
-
-// 1. ؽó  ε Լ
-GLuint LoadTexture(const char* filename) {
-	GLuint textureID;
-	glGenTextures(1, &textureID);
-	glBindTexture(GL_TEXTURE_2D, textureID);
-
-	// ؽó ݺ  ͸ 
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	// ũ:  Ű Ƿ ε   
+	if (GLContext::isOffscreen()) {
+		g_startRequested = true;
+		g_fixedFrameStep = true;
+	}
 
-	int w, h, nrChannels;
-	stbi_set_flip_vertically_on_load(true); // OpenGL ǥ迡   
-	unsigned char* data = stbi_load(filename, &w, &h, &nrChannels, 0);
+	// ġũ:  ڽ  ʰ ׸, ε  ٷ 
+	if (g_benchmark) {
+		g_endlessMode = false;
+		g_uncapped = true;
+		g_startRequested = true;
+		g_fixedFrameStep = true;
+		DynamicResolution::setEnabled(false);
+		if (!seedGiven) {
+			g_seed = BENCHMARK_SEED;
+			seedGiven = true;
+		}
+	}
 
-	if (data) {
-		GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-		glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, GL_UNSIGNED_BYTE, data);
-		glGenerateMipmap(GL_TEXTURE_2D);
-		std::cout << "ؽó ε : " << filename << std::endl;
+	// õ: ̸ ȭ  , ƴϸ --seed Ǵ ð (ڽ      )
+	// ڽ ̵ ̸ ȭ  
+	if (!seedGiven) g_seed = (unsigned int)time(NULL);
+	if (g_replayPath) {
+		if (!Replay::startPlayback(g_replayPath)) exit(1);
+		g_seed = Replay::getSeed();
+		g_endlessMode = Replay::getCourseLength() <= 0.0f;
+		if (!g_endlessMode) g_totalDistance = Replay::getCourseLength();
 	}
-	else {
-		std::cout << "ؽó ε : " << filename << std::endl;
+	else if (g_recordPath) {
+		Replay::startRecording(g_recordPath, g_seed, g_endlessMode ? 0.0f : g_totalDistance, g_checkInterval);
 	}
-	stbi_image_free(data);
-	return textureID;
-}
-
-// 2. ؽó  ť ׸ Լ ( )
-void DrawTexturedCube(GLuint shaderID, glm::mat4 modelMat, glm::vec3 scale) {
-	// ġ(3) + (3) + UVǥ(2) = 8 
-	static float texCubeVertices[] = {
-		// 
-		-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f,
-		 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f,
-		-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f,
-		-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 1.0f,
-		// 
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f,
-		 0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 0.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f,
-		-0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 1.0f,
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f,
-		// 
-		-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-		-0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 1.0f,
-		-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
-		-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
-		-0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 0.0f,
-		-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-		// 
-		 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-		 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
-		 0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 1.0f,
-		 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
-		 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-		 0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 0.0f,
-		 // Ʒ
-		 -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f,
-		  0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 1.0f,
-		  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f,
-		  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f,
-		 -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f,
-		 -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f,
-		 // 
-		 -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
-		  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f,
-		  0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 1.0f,
-		  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f,
-		 -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
-		 -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f
-	};
-	
-	if (tVAO == 0) {
-		glGenVertexArrays(1, &tVAO);
-		glGenBuffers(1, &tVBO);
-		glBindVertexArray(tVAO);
-		glBindBuffer(GL_ARRAY_BUFFER, tVBO);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(texCubeVertices), texCubeVertices, GL_STATIC_DRAW);
 
-		// 0: ġ (3)
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-		glEnableVertexAttribArray(0);
-		// 1:  (3) -  Vertex Shader location 2(Normal) ߱   ʿ  
-		//   : location 1=Color, 2=Normal ϼ .
-		// acting3_vertex.glsl Ȯ : 0=Pos, 1=Color, 2=Normal ̾, 
-		// ؽó   Shader ؾ . (Ʒ 3ܰ )
-
-		// **[߿]** ̴ location  缭 
-		// 0: Pos, 1: Normal, 2: TexCoord  մϴ.
-		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-		glEnableVertexAttribArray(1);
-
-		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-		glEnableVertexAttribArray(2);
+	// ũ  ڽ(   ڽ  )  Ƿ  θ 
+	if (GLContext::isOffscreen() && g_endlessMode && g_maxFrames <= 0) {
+		std::cerr << "ũ  ڽ  ʽϴ: --frames N  ּ" << std::endl;
+		GLContext::destroy();
+		return 1;
 	}
 
-	glBindVertexArray(tVAO);
-
-	//   
-	modelMat = glm::scale(modelMat, scale);
-	glUniformMatrix4fv(glGetUniformLocation(shaderID, "model"), 1, GL_FALSE, glm::value_ptr(modelMat));
+	//  GPU ð (Ÿ̸   ƹ͵  )
+	GpuProfiler::init();
+	if (g_benchmark) GpuProfiler::setResultListener(Benchmark::addGpuResult);
 
-	// ؽó  ÷ ѱ
-	glUniform1i(glGetUniformLocation(shaderID, "useTexture"), true);
+	// ڻ ε ŸƲ ȭ    (ù  ٸ )
+	// CPU ۾(̹ ŷ/, OBJ Ľ) ۾ , GL ε drawScene AssetLoader::pump
+	AssetLoader::init(ASSET_LOADER_THREADS);
 
-	// ؽó ε
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, g_wallTextureID);
-	glUniform1i(glGetUniformLocation(shaderID, "wallTexture"), 0);
+	// [߰] ŸƲ ̹ ε (ϸ 'title.jpg' ּ)
+	// ó   .ctex ŷ ΰ ʹ Ӹ/ ĳø ٷ ø
+	AssetLoader::requestTexture("title.jpg", &g_titleTextureID);
+
+	//  ؽó  ĳ÷ ε
+	AssetLoader::requestTexture("MAP_wall.jpg", &g_wallTextureID);
+
+	AssetLoader::requestJob("Octopus_1.obj",
+		[] { return Enemy::loadOctopusMesh("Octopus_1.obj"); },
+		[] {
+			if (!Enemy::createOctopusBuffers(g_mainShaders)) {
+				std::cerr << " ʱȭ " << std::endl;
+				return false;
+			}
+			return true;
+		});
+
+	// Ʒ GL ؽƮ ʿؼ  忡  
+	AssetLoader::requestMainThread("shader", [] {
+		//    ʱȭ  ʿ ͸ ޾  (̳ʸ ProgramCache )
+		g_mainShaders.init("acting3_vertex.glsl", "acting3_fragment.glsl");
+		// ī޶/ uniform  (丶   )
+		CameraUBO::init();
+		//  Ŭ  (ϸ     ״)
+		if (!LightGrid::init()) std::cerr << "Ŭ  ʱȭ " << std::endl;
+		return true;
+	});
+	// DrawCube//ڿ Ʈ  (  )
+	AssetLoader::requestMainThread("debug draw", [] {
+		if (!DebugDraw::init()) {
+			std::cerr << " ׸ ʱȭ " << std::endl;
+			return false;
+		}
+		return true;
+	});
+	// ʻȭ ũ  (ϸ ʻȭ   )
+	AssetLoader::requestMainThread("portrait", [] {
+		if (!Portrait::init(PORTRAIT_SIZE, g_portraitInterval)) {
+			std::cerr << "ʻȭ ʱȭ " << std::endl;
+		}
+		return true;
+	});
+
+	//  ػ   (ϸ ó â ٷ ׸)
+	AssetLoader::requestMainThread("dynamic resolution", [] {
+		DynamicResolution::setTargetFrameMs(g_dynresTargetMs);
+		DynamicResolution::setScaleBounds(g_dynresMinScale, g_dynresMaxScale);
+		if (!DynamicResolution::init(width, height)) {
+			std::cerr << " ػ ʱȭ " << std::endl;
+		}
+		return true;
+	});
+
+	// ͳ ûũ ۾ 忡   ũ  ۷   (ؽó ť VBO )
+	//   ڽ  0 =  
+	AssetLoader::requestMainThread("tunnel", [] {
+		InitBuffer();
+		if (!Tunnel::initTunnel(g_mainShaders, tVBO, g_endlessMode ? 0.0f : g_totalDistance)) {
+			std::cerr << "ͳ ʱȭ " << std::endl;
+			return false;
+		}
+		return true;
+	});
 
-	glDrawArrays(GL_TRIANGLES, 0, 36);
+	// ĳ ʱȭ (OBJ   )
+	AssetLoader::requestMainThread("character", [] {
+		if (!Character::initCharacter("character.obj", g_mainShaders)) {
+			std::cerr << "ĳ ʱȭ " << std::endl;
+			return false;
+		}
+		return true;
+	});
 
-	// ؽó  ÷  (ٸ ü   ְ)
-	glUniform1i(glGetUniformLocation(shaderID, "useTexture"), false);
+	UIManager::Init();
+	lastTime = std::chrono::steady_clock::now();
 
-	glBindVertexArray(0);
-}
 
-void make_vertexShaders()
-{
-	GLchar* vertexSource;
-	vertexSource = filetobuf("acting3_vertex.glsl");
-
-	vertexShader = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertexShader, 1, &vertexSource, NULL);
-	glCompileShader(vertexShader);
-	GLint result;
-	GLchar errorLog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &result);
-	if (!result)
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, errorLog);
-		std::cerr << "ERROR: vertex shader  \n" << errorLog << std::endl;
-		return;
+	// â  glut ݹ (ũ GLContext::mainLoop drawScene  θ)
+	if (!GLContext::isOffscreen()) {
+		glutDisplayFunc(drawScene);
+		glutReshapeFunc(Reshape);
+		glutKeyboardFunc(keyboard);
+		glutKeyboardUpFunc(keyboardUp);  // Ű  ݹ ߰
+		glutSpecialFunc(specialKeyboard);
+		glutSpecialUpFunc(specialKeyboardUp);  // ƯŰ  ݹ ߰
+		// ġũ idle  ׸ (Ÿ̸ ġ   ð  ʰ  )
+		if (!g_benchmark) glutTimerFunc(16, timer, 0);
+		if (g_uncapped) glutIdleFunc(idle);
+
+		std::cout << "=== ĳ ۹ ===" << std::endl;
+		std::cout << "Ű: ĳ XZ  ̵" << std::endl;
+		std::cout << "g: GL  ĳ  " << std::endl;
+		std::cout << "q: " << std::endl;
 	}
-}
 
-void make_fragmentShaders()
-{
-	GLchar* fragmentSource;
-	fragmentSource = filetobuf("acting3_fragment.glsl");
-
-	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
-	glCompileShader(fragmentShader);
-	GLint result;
-	GLchar errorLog[512];
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &result);
-	if (!result)
-	{
-		glGetShaderInfoLog(fragmentShader, 512, NULL, errorLog);
-		std::cerr << "ERROR: frag_shader  \n" << errorLog << std::endl;
-		return;
-	}
+	GLContext::mainLoop(drawScene, Reshape);
+	return 0;
 }
 
-GLuint make_shaderProgram()
-{
-	GLint result;
-	GLchar errorLog[512];
-	GLuint shaderID;
-	shaderID = glCreateProgram();
-	glAttachShader(shaderID, vertexShader);
-	glAttachShader(shaderID, fragmentShader);
-	glLinkProgram(shaderID);
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
-	glGetProgramiv(shaderID, GL_LINK_STATUS, &result);
-	if (!result) {
-		glGetProgramInfoLog(shaderID, 512, NULL, errorLog);
-		std::cerr << "ERROR: shader program  \n" << errorLog << std::endl;
-		return false;
-	}
-	glUseProgram(shaderID);
-	return shaderID;
-}
+// ġ(3) + (3) + UVǥ(2) = 8 
+static float texCubeVertices[] = {
+	// 
+	-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f,
+	 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f,
+	 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f,
+	 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f,
+	-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f,
+	-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 1.0f,
+	// 
+	-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f,
+	 0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 0.0f,
+	 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f,
+	 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f,
+	-0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 1.0f,
+	-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f,
+	// 
+	-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
+	-0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 1.0f,
+	-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
+	-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
+	-0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 0.0f,
+	-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
+	// 
+	 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
+	 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
+	 0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 1.0f,
+	 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,
+	 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
+	 0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 0.0f,
+	 // Ʒ
+	 -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f,
+	  0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 1.0f,
+	  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f,
+	  0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f,
+	 -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f,
+	 -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f,
+	 // 
+	 -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
+	  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f,
+	  0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 1.0f,
+	  0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f,
+	 -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
+	 -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f
+};
 
 void InitBuffer()
 {
-	//  ʱȭ ׸ Լ  ó
+	// ؽó ť(tVAO) ͳ Ƿ     
+	glGenVertexArrays(1, &tVAO);
+	glGenBuffers(1, &tVBO);
+	GLState::bindVertexArray(tVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, tVBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(texCubeVertices), texCubeVertices, GL_STATIC_DRAW);
+
+	// 0: ġ (3)
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	// 1:  (3) -  Vertex Shader location 2(Normal) ߱   ʿ  
+	//   : location 1=Color, 2=Normal ϼ .
+	// acting3_vertex.glsl Ȯ : 0=Pos, 1=Color, 2=Normal ̾, 
+	// ؽó   Shader ؾ . (Ʒ 3ܰ )
+
+	// **[߿]** ̴ location  缭 
+	// 0: Pos, 1: Normal, 2: TexCoord  մϴ.
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+	glEnableVertexAttribArray(2);
+	GLState::bindVertexArray(0);
 }
 
 // ī޶ ġ Ʈ ()
@@ -366,311 +441,298 @@ float lerp(float current, float target, float speed)
 	return current + diff * speed;
 }
 
+// "60Hz    Ÿ speedŭ"  dt   ٲ ( ̿   )
+float SmoothFactor(float perFrame, float dt)
+{
+	return 1.0f - powf(1.0f - perFrame, dt * 60.0f);
+}
+
 // ü ׸ Լ
+// Ź VAO/VBO   ʰ DebugDraw Ʈ ۿ ׾ ξٰ
+// Ӹ   ׸ϴ.
 void DrawCube(glm::mat4 modelMat, glm::vec3 color, glm::vec3 scale)
 {
-	GLfloat cubeVertices[] = {
-		// ġ (x,y,z) +  (nx,ny,nz)
-		// ո (Z+)
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-		 0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-		-0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-
-		// ޸ (Z-)
-		 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-		-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-		-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-		 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-		-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-
-		 //   (X-)
-		 -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-		 -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-		 -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-		 -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-		 -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-		 -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-
-		 //   (X+)
-		  0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-		  0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-		  0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-		  0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-		  0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-		  0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-
-		  //  (Y+)
-		  -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-		   0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-		   0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
-		  -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-		   0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
-		  -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
-
-		  // Ʒ (Y-)
-		  -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-		   0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-		   0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,
-		  -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-		   0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,
-		  -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f
-	};
-
-	GLuint VAO, VBO, colorVBO;
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glGenBuffers(1, &colorVBO);
-
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
-
-	// ġ Ӽ
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-	glEnableVertexAttribArray(0);
-	//  Ӽ
-	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-	glEnableVertexAttribArray(2);
-
-	//  
-	GLfloat colors[108];
-	for (int i = 0; i < 36; i++) {
-		colors[i * 3 + 0] = color.r;
-		colors[i * 3 + 1] = color.g;
-		colors[i * 3 + 2] = color.b;
-	}
-
-	glBindBuffer(GL_ARRAY_BUFFER, colorVBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(colors), colors, GL_STATIC_DRAW);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
-	glEnableVertexAttribArray(1);
-
-	// ȯ  
-	modelMat = glm::scale(modelMat, scale);
-
-	// ī޶ y  
-	glm::vec3 rotatedCameraPos = cameraPos;
-	glm::mat4 cameraRotMat = glm::rotate(glm::mat4(1.0f), glm::radians(cameraRotationY), glm::vec3(0.0f, 1.0f, 0.0f));
-	glm::vec4 rotatedPos = cameraRotMat * glm::vec4(cameraPos, 1.0f);
-	rotatedCameraPos = glm::vec3(rotatedPos);
-
-	glm::mat4 viewMat = glm::lookAt(rotatedCameraPos, cameraTarget, cameraUp);
-	glm::mat4 projectionMat = glm::perspective(glm::radians(45.0f), (float)width / (float)height, 0.1f, 100.0f);
-
-	GLuint modelLoc = glGetUniformLocation(shaderProgramID, "model");
-	GLuint viewLoc = glGetUniformLocation(shaderProgramID, "view");
-	GLuint projectionLoc = glGetUniformLocation(shaderProgramID, "projection");
-	//GLuint lightPosLoc = glGetUniformLocation(shaderProgramID, "lightPos");
-	//GLuint lightColorLoc = glGetUniformLocation(shaderProgramID, "lightColor");
-	GLuint viewPosLoc = glGetUniformLocation(shaderProgramID, "viewPos");
-
-	glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(modelMat));
-	glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMat));
-	glUniformMatrix4fv(projectionLoc, 1, GL_FALSE, glm::value_ptr(projectionMat));
-	//glUniform3fv(lightPosLoc, 1, glm::value_ptr(lightPos));
-	//glUniform3fv(lightColorLoc, 1, glm::value_ptr(lightColor));
-	glUniform3fv(viewPosLoc, 1, glm::value_ptr(rotatedCameraPos));
-
-	glDrawArrays(GL_TRIANGLES, 0, 36);
-
-	glDeleteBuffers(1, &VBO);
-	glDeleteBuffers(1, &colorVBO);
-	glDeleteVertexArrays(1, &VAO);
+	DebugDraw::cube(modelMat, color, scale);
 }
 
-void DrawSurvivalMap()
+void DrawSurvivalMap(const glm::mat4& viewProj)
 {
-	const int MAP_WIDTH = 5;
-	const int TUNNEL_HEIGHT = 5;
-
-	GLuint useTextureLoc = glGetUniformLocation(shaderProgramID, "useTexture");
-
-	// ؽó ε     ȭ (DrawTexturedCube  ε ߺ,    )
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, g_wallTextureID);
-
+	PROFILE_ZONE("DrawSurvivalMap");
 	// [ȭ ٽ] ü (0~500)  ׸ ʰ, ĳ ġ  յ  Ÿ ׸ϴ.
 	// ĳ ġ 
 	float characterZ = Character::getPosition().z;
 	// þ  
 	float startZ = characterZ - 10.0f; // ĳ  10m
 
-	float endZ = characterZ + 50.0f; // ĳ  50m
-	if (endZ > 800.0f) endZ = 800.0f;
+	float endZ = characterZ + 100.0f; // ĳ  100m (  far = 100 )
 
+	// ٴ + 翷  +   32m ûũ  ÷ νϽ ׸ϴ.
+	// þ  ̰ų ü ġ ʴ ûũ ׸ Ƿ
+	// ڽ ü (g_totalDistance)  ̴ Ÿŭ  ϴ.
+	Tunnel::drawTunnel(g_wallTextureID, viewProj, startZ, endZ);
+	//     (Ŭ )
+	Tunnel::submitLights(startZ, endZ);
+}
 
-	// ݺ  startZ ~ endZ 
-	for (float z = -10; z < 800; z += 1.0f) {
-		for (int x = -MAP_WIDTH; x < MAP_WIDTH; ++x) {
-			// 1. ٴ (Floor)
-			glm::mat4 modelFloor = glm::translate(glm::mat4(1.0f), glm::vec3(x * 1.0f, -1.0f, z * 1.0f));
-			DrawTexturedCube(shaderProgramID, modelFloor, glm::vec3(1.5f, 0.1f, 1.0f));
+// ÷  
+// World::step ĳ/ World::ORIGIN_REBASE_DISTANCEŭ ڷ  ī޶/ͳε  ŭ űϴ.
+// ûũ  ŭ űǷ Ÿ ڰ ߳ ʽϴ.
+void UpdateFloatingOrigin()
+{
+	double originOffsetZ = World::getOriginOffset();
+	if (originOffsetZ == g_originOffsetZ) return;
 
-			// 2. 翷  (Walls)
-			if (abs(x) == MAP_WIDTH) {
-				float wallH = (float)TUNNEL_HEIGHT + 1.0f;
-				float wallY = (wallH / 2.0f) - 1.0f;
+	float shift = (float)(originOffsetZ - g_originOffsetZ);
+	g_originOffsetZ = originOffsetZ;
 
-				glm::mat4 modelWall = glm::translate(glm::mat4(1.0f), glm::vec3(x * 1.0f, wallY, z * 1.0f));
-				glm::mat4 modelWall2 = glm::translate(glm::mat4(1.0f), glm::vec3(-x * 1.0f, wallY, z * 1.0f));
+	cameraPos.z -= shift;
+	g_prevCameraPos.z -= shift;
+	cameraTarget.z -= shift;
+	Tunnel::setOriginOffset(g_originOffsetZ);
+}
 
-				glUniform1i(useTextureLoc, true);
+// ŸƲ -> غ: 2   . 嵵 õ ó (ȭ/ ⼭  )
+void StartRun()
+{
+	g_gameState = READY;
+	World::startRun(g_seed, g_endlessMode ? 0.0f : g_totalDistance);
+	UpdateFloatingOrigin();
+	g_frameIndex = 0;
+	if (g_benchmark) Benchmark::begin();
+}
 
-				//  DrawTexturedCube Լ ״ ٸ ̴ ȣص Ƚ پ ϴ.
-				DrawTexturedCube(shaderProgramID, modelWall, glm::vec3(0.5f, wallH, 1.0f));
-				DrawTexturedCube(shaderProgramID, modelWall2, glm::vec3(0.5f, wallH, 1.0f));
-			}
+// ġũ :    ( ų 忡 ϸ  ڵ 1)
+void FinishBenchmark()
+{
+	Benchmark::RunInfo info;
+	info.seed = g_seed;
+	info.input = g_replayPath ? g_replayPath : "script";
+	const char* renderer = (const char*)glGetString(GL_RENDERER);
+	const char* version = (const char*)glGetString(GL_VERSION);
+	info.renderer = renderer ? renderer : "";
+	info.glVersion = version ? version : "";
+	info.width = width;
+	info.height = height;
+	info.distance = World::getDistance();
+	info.runSeconds = World::getRunTime();
+	bool ok = Benchmark::writeReport(g_benchmarkPath, info);
+	if (Replay::hasDiverged()) {
+		std::cerr << "[ġũ] ȭ  Դϴ (" << Replay::getDivergedTick() << ")" << std::endl;
+		ok = false;
+	}
+	Shutdown(ok ? 0 : 1);
+}
+
+// ڿ    ('q', ġũ )
+void Shutdown(int exitCode)
+{
+	Replay::finish();   //     ȭ  
+	AssetLoader::cleanup();
+	Character::cleanup();
+	Tunnel::cleanup();
+	DebugDraw::cleanup();
+	Portrait::cleanup();
+	CameraUBO::cleanup();
+	LightGrid::cleanup();
+	DynamicResolution::cleanup();
+	GpuProfiler::cleanup();
+	g_mainShaders.destroy();
+	GLContext::destroy();
+	exit(exitCode);
+}
+
+//  : ȭ (--capture-every) ->  ȯ ->   (--frames)
+//  (ŸƲ/ε)    (ε ӵ   ȣ =  )
+void EndFrame()
+{
+	bool counted = (g_gameState != TITLE);
+	if (counted) {
+		g_frameIndex++;
+		if (g_captureEvery > 0 && g_frameIndex % g_captureEvery == 0) {
+			char path[256];
+			snprintf(path, sizeof(path), "%s%06d.ppm", g_capturePrefix, g_frameIndex);
+			GLContext::saveFramebuffer(path);
 		}
 	}
 
-	//   ָ ־  Ѵٸ  ׸ų, þ     ׷ϴ.
-	//  ׻ ̰ ϰ ʹٸ   ׸ϴ.
-	if (endZ >= g_totalDistance - 10.0f) { //   þ߿  ׸
-		glm::mat4 goalModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.1f, g_totalDistance - 5.0f));
-		DrawTexturedCube(shaderProgramID, goalModel, glm::vec3(MAP_WIDTH * 2.5f, 0.1f, 1.0f));
+	GLContext::swapBuffers();
+
+	if (counted && g_maxFrames > 0 && g_frameIndex >= g_maxFrames) {
+		if (g_benchmark) FinishBenchmark();
+		else Shutdown(0);
+	}
+}
+
+//     (World::STEP_DT): Է -> (ĳ//浹, غ/, ) -> ī޶
+void SimulationStep(float dt)
+{
+	PROFILE_ZONE("SimulationStep");
+	// Է°       ( ̸ ȭ Է, ȭ ̸  Է )
+	SimInput input = {};
+	if (World::getPhase() == World::PHASE_PLAYING && !allAnimationsStopped) {
+		// ġũ/ũ 뺻:   (Ű尡 , --replay Ʒ ȭ Է ٲ)
+		if (g_benchmark || GLContext::isOffscreen()) input.up = true;
+		else input = ReadInput();
 	}
+	input = Replay::nextInput(input);
+	World::step(input);
+	Replay::endStep(World::checksum);
+
+	// غ īƮٿ /  World 
+	if (World::getPhase() == World::PHASE_PLAYING) g_gameState = PLAYING;
+	else if (World::getPhase() == World::PHASE_FINISHED) {
+		g_gameState = FINISHED;
+		Replay::finish();
+	}
+
+	//  Ÿ ǥ ۰  (World ű ŭ ī޶/ͳε)
+	UpdateFloatingOrigin();
 
-	glUniform1i(useTextureLoc, false);
+	// ī޶ ĳ   ǥ ġ ε巴 
+	glm::vec3 characterPos = Character::getPosition();
+	glm::vec3 cameraGoalPos = glm::vec3(
+		0.0f,      // ĳ 
+		characterPos.y + CAMERA_HEIGHT,           // ĳ 
+		characterPos.z - CAMERA_BACK_DISTANCE     // ĳ 
+	);
+	g_prevCameraPos = cameraPos;
+	cameraPos += (cameraGoalPos - cameraPos) * SmoothFactor(CAMERA_FOLLOW_SPEED, dt);
 }
 
 GLvoid drawScene()
 {
+	PROFILE_ZONE("drawScene");
 	// Ÿ  Լ
 	auto now = std::chrono::steady_clock::now();
 	float dt = std::chrono::duration<float>(now - lastTime).count();
 	lastTime = now;
-	if (dt > 0.1f) dt = 0.1f;
+	float realFrameMs = dt * 1000.0f;
+	if (dt > MAX_FRAME_DT) dt = MAX_FRAME_DT;
+	if (g_fixedFrameStep) dt = FIXED_FRAME_DT;
+
+	// GL  ĳ    
+	GLState::beginFrame();
+	// GPU  ð:     а ̹   
+	GpuProfiler::beginFrame();
+
+	// ġũ:    (draw call / ﰢ   beginFrame Ȯ)
+	if (g_benchFramePending) {
+		const GLState::Stats& frameStats = GLState::getFrameStats();
+		g_benchFrame.drawCalls = frameStats.drawCalls;
+		g_benchFrame.triangles = frameStats.triangles;
+		Benchmark::addFrame(g_benchFrame);
+		g_benchFramePending = false;
+	}
 
 	if (g_gameState == TITLE) {
+		//  ڻ ݾ GL ø (ʼ ʱȭ ϸ ó )
+		if (!AssetLoader::isReady()) {
+			AssetLoader::pump(ASSET_UPLOAD_BUDGET_MS);
+			if (AssetLoader::hasFailed()) {
+				std::cerr << "ڻ ε : " << AssetLoader::getFailedName() << std::endl;
+				exit(1);
+			}
+		}
+		if (g_startRequested && AssetLoader::isReady()) {
+			// ġũ ؽó  ٸ   ̹Ƿ з 
+			if (g_benchmark && AssetLoader::getMissingTextureCount() > 0) {
+				std::cerr << "[ġũ] ؽó ε : " << AssetLoader::getMissingTextureName()
+					<< " (" << AssetLoader::getMissingTextureCount() << ")" << std::endl;
+				Shutdown(1);
+			}
+			StartRun();
+		}
+
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		// UI Ŵ   ̹ ׸
-		UIManager::DrawTitleScreen(width, height, g_titleTextureID);
-
-		glutSwapBuffers();
+		// UI Ŵ   ̹ ׸ (ε ̸  뵵)
+		UIManager::DrawTitleScreen(width, height, g_titleTextureID, AssetLoader::getProgress());
+		EndFrame();
+		g_simAccumulator = 0.0; // ϸ ù ܺ
+		if (!AssetLoader::isReady()) GLContext::postRedisplay(); // ε ߿ Ÿ̸Ӹ ٸ ʰ  
 		return; //  ȭ ׸ ʰ 
 	}
 
-	if (g_gameState == READY) {
-		g_readyTime -= dt;
-		if (g_readyTime <= 0.0f) {
-			g_gameState = PLAYING;
-			g_startTime = 0.0f;
-		}
+	// ̹  ðŭ World::STEP_DT ùķ̼ ϰ, ڶ    ѱ
+	World::beginFrame();
+	g_simAccumulator += dt;
+	while (g_simAccumulator >= World::STEP_DT && g_gameState != FINISHED) {
+		SimulationStep(World::STEP_DT);
+		g_simAccumulator -= World::STEP_DT;
 	}
-	else if (g_gameState == PLAYING) {
-		g_startTime += dt;
-		if (Character::getPosition().z >= g_totalDistance) 
-			g_gameState = FINISHED;
-	}
-	else if (g_gameState == FINISHED) {
+
+	if (g_gameState == FINISHED) {
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		//  ȭ ׸ ( g_startTime   )
-		UIManager::DrawFinishScreen(width, height, g_titleTextureID, g_startTime);
+		//  ȭ ׸ (  World::getRunTime  )
+		UIManager::DrawFinishScreen(width, height, g_titleTextureID, World::getRunTime());
 
-		glutSwapBuffers();
+		EndFrame();
+		if (g_benchmark) FinishBenchmark();
+		else if (GLContext::isOffscreen()) Shutdown(0);   // ũ  ȭ   ׸ 
 		return; 
 	}
 
+	//  ð =  ܿ  ܱ   ->    ̸   ؼ ׸
+	float alpha = (float)(g_simAccumulator / World::STEP_DT);
+	Character::interpolate(alpha);
+	Enemy::interpolate(alpha);
+
+	//  ͳ ûũ ̸ û
+	Tunnel::updateStreaming(Character::getPosition().z);
+
+	// 3D   ػ ۿ (ũ  ӱ  ð )
+	DynamicResolution::beginScene(width, height);
 	glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	glEnable(GL_DEPTH_TEST);
-	glUseProgram(shaderProgramID);
 
-	// ĳ  ġ 
-	glm::vec3 characterPos = Character::getPosition();
-	// ǥ ī޶ ġ 
-	glm::vec3 cameraGoalPos = glm::vec3(
-		0.0f,      // ĳ 
-		characterPos.y + CAMERA_HEIGHT,           // ĳ 
-		characterPos.z - CAMERA_BACK_DISTANCE     // ĳ 
-	);
-	// ī޶ ġ ε巴 ̵ ( )
-	cameraPos.x = cameraPos.x + (cameraGoalPos.x - cameraPos.x) * CAMERA_FOLLOW_SPEED;
-	cameraPos.y = cameraPos.y + (cameraGoalPos.y - cameraPos.y) * CAMERA_FOLLOW_SPEED;
-	cameraPos.z = cameraPos.z + (cameraGoalPos.z - cameraPos.z) * CAMERA_FOLLOW_SPEED;
+	// ĳ/ī޶  ġ (ùķ̼   ̿ ״)
+	glm::vec3 characterPos = Character::getRenderPosition();
+	glm::vec3 renderCameraPos = glm::mix(g_prevCameraPos, cameraPos, alpha);
+
+	// ī޶ ٶ󺸴 : ĳ ߽ ణ 
+	cameraTarget.x = 0.0f;
+	cameraTarget.y = characterPos.y + CAMERA_TARGET_HEIGHT;
+	cameraTarget.z = characterPos.z + CAMERA_BACK_DISTANCE;
 
 	// ī޶ ȸ 
-	glm::vec3 rotatedCameraPos = cameraPos;
+	glm::vec3 rotatedCameraPos = renderCameraPos;
 	glm::mat4 cameraRotMat = glm::rotate(glm::mat4(1.0f), glm::radians(cameraRotationY), glm::vec3(0.0f, 1.0f, 0.0f));
-	glm::vec4 rotatedPos = cameraRotMat * glm::vec4(cameraPos, 1.0f);
+	glm::vec4 rotatedPos = cameraRotMat * glm::vec4(renderCameraPos, 1.0f);
 	rotatedCameraPos = glm::vec3(rotatedPos);
 
-	glm::mat4 model = glm::mat4(1.0f);
 	glm::mat4 view = glm::lookAt(rotatedCameraPos, cameraTarget, cameraUp);
-	glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)width / (float)height, 0.1f, 100.0f);
-
-	GLuint modelLoc = glGetUniformLocation(shaderProgramID, "model");
-	GLuint viewLoc = glGetUniformLocation(shaderProgramID, "view");
-	GLuint projectionLoc = glGetUniformLocation(shaderProgramID, "projection");
-
-	glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-	glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view));
-	glUniformMatrix4fv(projectionLoc, 1, GL_FALSE, glm::value_ptr(projection));
+	glm::mat4 projection = glm::perspective(glm::radians(CAMERA_FOV_Y), (float)width / (float)height, CAMERA_NEAR, CAMERA_FAR);
 
 	//  ġ  
 	glm::vec3 lightPos = glm::vec3(characterPos.x, characterPos.y + 5.0f, characterPos.z - 0.5f);
 	glm::vec3 lightColor = glm::vec3(1.0f, 1.0f, 1.0f);
 
-	GLuint lightPosLoc = glGetUniformLocation(shaderProgramID, "lightPos");
-	GLuint lightColorLoc = glGetUniformLocation(shaderProgramID, "lightColor");
-	glUniform3fv(lightPosLoc, 1, glm::value_ptr(lightPos));
-	glUniform3fv(lightColorLoc, 1, glm::value_ptr(lightColor));
-	
-	// ī޶ ٶ󺸴 : ĳ ߽ ణ 
-	cameraTarget.x = 0.0f;
-	cameraTarget.y = characterPos.y + CAMERA_TARGET_HEIGHT;
-	cameraTarget.z = characterPos.z + CAMERA_BACK_DISTANCE;
-
-	DrawSurvivalMap();
+	//  : ī޶ +  UBO    ( Ŭ͸ ä  flush )
+	CameraBlock mainCamera;
+	mainCamera.view = view;
+	mainCamera.projection = projection;
+	mainCamera.viewPos = glm::vec4(rotatedCameraPos, 1.0f);
+	mainCamera.lightPos = glm::vec4(lightPos, 1.0f);
+	mainCamera.lightColor = glm::vec4(lightColor, 1.0f);
+
+	//  :   Ŷ ְ, ĵ  flush Ѳ ׸
+	LightGrid::begin();
+	RenderQueue::begin(view);
+	DrawSurvivalMap(projection * view);
 	Character::drawCharacter();
-	// [߰]    Ʈ (  )
+	//    (  ,  World::update)
 	if (g_gameState == PLAYING) {
-		Enemy::updateOctopus(characterPos, dt);
-		PlayerStun stunInfo = { false, 0.0f, 0.0f };
-		if (Enemy::checkElectricityCollision(characterPos, 0.5f, stunInfo)) {
-			Character::applyStun(stunInfo.stunDuration);
-		}
 		Enemy::drawOctopus();
 		Enemy::drawElectricity();
+		Enemy::submitLights();
 	}
-	
-
-	// ==========================================
-	// 2. ĳ ʻȭ ( ϴ  ȭ)
-	// ==========================================
-	int charViewSize = 150;
-	// [] ȭ  ߾ӿ ġϵ Yǥ 
-	int viewY = (height - charViewSize) / 2;
-
-	// Ʈ  (X=20, Y=߾)
-	glViewport(20, viewY, charViewSize, charViewSize);
-	glClear(GL_DEPTH_BUFFER_BIT); // ̸  ( )
-
-	// ʻȭ ī޶
-	glm::vec3 uiCamPos = characterPos + glm::vec3(0.0f, 0.9f, 1.0f);
-	glm::vec3 uiCamTarget = characterPos + glm::vec3(0.0f, 0.9f, 0.0f);
-
-	glm::mat4 uiView = glm::lookAt(uiCamPos, uiCamTarget, glm::vec3(0, 1, 0));
-
-	glm::mat4 uiProj = glm::ortho(-0.8f, 0.8f, -0.8f, 0.8f, 0.1f, 10.0f);
-
-	glUniformMatrix4fv(glGetUniformLocation(shaderProgramID, "view"), 1, GL_FALSE, glm::value_ptr(uiView));
-	glUniformMatrix4fv(glGetUniformLocation(shaderProgramID, "projection"), 1, GL_FALSE, glm::value_ptr(uiProj));
-	Character::drawCharacter();
-
-	// Ʈ 
-	glViewport(0, 0, width, height);
 
 	// ==========================================
-	// 3. 2D UI ׸ (Ÿ̸, , )
+	// 2. 2D UI ׸ (Ÿ̸, , )
 	// ==========================================
 	std::string timerText;
 	if(g_gameState == READY) {
@@ -680,16 +742,98 @@ GLvoid drawScene()
 		timerText = "FINISH!";
 	}
 	else if(g_gameState == PLAYING) {
-		int min = (int)g_startTime / 60;
-		int sec = (int)g_startTime % 60;
-		int ms = (int)((g_startTime - (int)g_startTime) * 100);
-		char buf[20]; sprintf_s(buf, "%02d:%02d:%02d", min, sec, ms);
+		float runTime = World::getRunTime();
+		int min = (int)runTime / 60;
+		int sec = (int)runTime % 60;
+		int ms = (int)((runTime - (int)runTime) * 100);
+		char buf[20]; snprintf(buf, sizeof(buf), "%02d:%02d:%02d", min, sec, ms);
 		timerText = buf;
 	}
 
-	UIManager::DrawAll(width, height, abs(characterPos.z), g_totalDistance, timerText, Character::isStunned());
+	//   1km   븦 ٽ ä
+	float uiDistance = abs(World::getDistance());
+	float uiTotal = g_totalDistance;
+	if (g_endlessMode) {
+		uiTotal = 1000.0f;
+		uiDistance = fmodf(uiDistance, uiTotal);
+	}
+	// DrawCube     ü    ׸
+	RenderQueue::submitCallback(PASS_TRANSPARENT, DebugDraw::flush, "debug draw");
+	// ̹ ӿ   Ŭͷ  ī޶ ϰ Բ ø
+	// (Ŭ Ÿ gl_FragCoord ̹Ƿ â ũⰡ ƴ϶   ũ)
+	LightGrid::build(view, glm::radians(CAMERA_FOV_Y), (float)width / (float)height, CAMERA_NEAR, CAMERA_FAR,
+		DynamicResolution::getSceneWidth(), DynamicResolution::getSceneHeight(), mainCamera);
+	CameraUBO::update(mainCamera);
+	RenderQueue::flush();
+
+	//  â ũ ÷ ̰, UI    ػ󵵷
+	// ʻȭ ġ ʴ ġ ʻȭ  ׷ 
+	{
+		GpuProfiler::Scope scope("upscale");
+		DynamicResolution::endScene(width, height);
+	}
+	{
+		GpuProfiler::Scope scope("hud");
+		UIManager::DrawAll(width, height, uiDistance, uiTotal, timerText, Character::isStunned());
+	}
+
+	// ==========================================
+	// 3. ĳ ʻȭ ( ϴ  ȭ)
+	// ==========================================
+	// ڼ ٲ  ũ ٽ ׸, ȭ鿡 ؽó ̱⸸ 
+	// (κ ޽ô ϰ ùķ̼ ٽ  )
+	{
+		GpuProfiler::Scope scope("portrait");
+		Portrait::update(mainCamera, characterPos, width, height);
+
+		// [] ȭ  ߾ӿ ġϵ Yǥ 
+		int viewY = (height - PORTRAIT_SIZE) / 2;
+		UIManager::DrawPortrait(width, height, Portrait::getTexture(), 20.0f, (float)viewY, (float)PORTRAIT_SIZE);
+	}
+
+	if (g_showGpuProfiler) DrawGpuProfilerOverlay();
+
+	// ġũ CPU ð  ȯ  (ȯ GPU/vsync ٸ ð frameMs)
+	if (g_benchmark) {
+		g_benchFrame.frameMs = realFrameMs;
+		g_benchFrame.cpuMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - now).count();
+		g_benchFrame.simMs = World::getFrameUpdateMs();
+		g_benchFrame.simSteps = World::getFrameSteps();
+		g_benchFramePending = Benchmark::isActive();
+	}
+
+	EndFrame();
+
+	//  ػ: Ÿ̸ ⸦  ̹  ۾ ð (ü GPU ٸ ð )
+	float frameMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - now).count();
+	DynamicResolution::reportFrameTime(frameMs);
+}
 
-	glutSwapBuffers();
+// 'p' : ̹  ùķ̼ CPU ð +  ֱ GPU ð (ms)
+void DrawGpuProfilerOverlay()
+{
+	std::vector<std::string> lines;
+	char buf[128];
+	// ùķ̼ CPU ( ̶ Ӹ   ٸ)
+	snprintf(buf, sizeof(buf), "sim %d steps  %.2f ms (CPU)", World::getFrameSteps(), World::getFrameUpdateMs());
+	lines.push_back(buf);
+	if (!GpuProfiler::isAvailable()) {
+		lines.push_back("GPU profiler: timer queries not supported");
+	}
+	else {
+		snprintf(buf, sizeof(buf), "GPU %.2f ms  (scale %.2f, dropped %d)",
+			GpuProfiler::getFrameMs(), DynamicResolution::getScale(), GpuProfiler::getDroppedFrames());
+		lines.push_back(buf);
+		lines.push_back("pass            avg    p50    p95    max");
+		for (int i = 0; i < GpuProfiler::getPassCount(); ++i) {
+			GpuProfiler::PassStats stats;
+			if (!GpuProfiler::getPassStats(i, stats) || stats.samples == 0) continue;
+			snprintf(buf, sizeof(buf), "%-12s %6.2f %6.2f %6.2f %6.2f",
+				stats.name.c_str(), stats.avgMs, stats.p50Ms, stats.p95Ms, stats.maxMs);
+			lines.push_back(buf);
+		}
+	}
+	UIManager::DrawStatsOverlay(width, height, lines);
 }
 
 GLvoid Reshape(int w, int h)
@@ -699,71 +843,25 @@ GLvoid Reshape(int w, int h)
 	height = h;
 }
 
+// Ű ¸   Է (PLAYING   ܸ,  World::update)
+SimInput ReadInput()
+{
+	SimInput input;
+	input.up = specialKeyStates[GLUT_KEY_UP];
+	input.down = specialKeyStates[GLUT_KEY_DOWN];
+	input.left = specialKeyStates[GLUT_KEY_LEFT];
+	input.right = specialKeyStates[GLUT_KEY_RIGHT];
+
+	// ̽ٷ  ( ),     ܸ
+	input.jump = keyStates[' '];
+	keyStates[' '] = false;
+	return input;
+}
+
+// ȭ  û (ùķ̼ drawScene  ܿ )
 GLvoid timer(int value)
 {
 	glutTimerFunc(16, timer, 0);
-	const float moveSpeed = 0.15f;
-
-	if (g_gameState == PLAYING && !allAnimationsStopped) {
-		// 8 Է ó
-		bool moveUp = specialKeyStates[GLUT_KEY_UP];
-		bool moveDown = specialKeyStates[GLUT_KEY_DOWN];
-		bool moveLeft = specialKeyStates[GLUT_KEY_LEFT];
-		bool moveRight = specialKeyStates[GLUT_KEY_RIGHT];
-
-		bool ismoving = moveUp or moveDown or moveLeft or moveRight;
-
-		Character::setRunning(ismoving);
-
-		// ¿ ̵
-		if (moveUp) {
-			Character::moveForward(moveSpeed);
-		}
-		if (moveDown) {
-			Character::moveBackward(moveSpeed);
-		}
-		if (moveLeft) {
-			Character::moveLeft(moveSpeed);
-		}
-		if (moveRight) {
-			Character::moveRight(moveSpeed);
-		}
-
-		if (moveUp && moveRight) {
-			Character::setTargetRotation(glm::radians(-45.0f)); 
-		}
-		else if (moveUp && moveLeft) {
-			Character::setTargetRotation(glm::radians(45.0f)); 
-		}
-		else if (moveDown && moveRight) {
-			Character::setTargetRotation(glm::radians(-135.0f)); 
-		}
-		else if (moveDown && moveLeft) {
-			Character::setTargetRotation(glm::radians(135.0f)); 
-		}
-		else if (moveUp) {
-			// (+Z)   0 ( +Z  ִٰ )
-			Character::setTargetRotation(glm::radians(0.0f));
-		}
-		else if (moveDown) {
-			// (-Z)   180
-			Character::setTargetRotation(glm::radians(180.0f));
-		}
-		else if (moveLeft) {
-			// (+X) -> ī޶ Ƿ  Ű  +X 
-			Character::setTargetRotation(glm::radians(90.0f));
-		}
-		else if (moveRight) {
-			// (-X)
-			Character::setTargetRotation(glm::radians(-90.0f));
-		}
-
-		// ̽ٷ  ( )
-		if (keyStates[' ']) {
-			Character::jump();
-			keyStates[' '] = false;
-		}
-	}
 	glm::vec3 debugPos = Character::getPosition();
 	std::cout << " ġ -> X: " << debugPos.x
 		<< " | Y: " << debugPos.y
@@ -773,6 +871,12 @@ GLvoid timer(int value)
 	
 }
 
+// --uncapped:    ٷ   ( ̶  )
+GLvoid idle()
+{
+	glutPostRedisplay();
+}
+
 GLvoid keyboard(unsigned char key, int x, int y)
 {
 	const float cameraSpeed = 0.3f;
@@ -783,16 +887,52 @@ GLvoid keyboard(unsigned char key, int x, int y)
 	switch (key) {
 	case 's':
 		if (g_gameState == TITLE) {
-						// ŸƲ ȭ鿡 's'   
-			g_gameState = READY;
-			g_readyTime = 2.0f; // 2   
+			// ŸƲ ȭ鿡 's'    (ڻ  ö󰡱 ̸  )
+			if (AssetLoader::isReady()) {
+				StartRun();
+			}
+			else {
+				g_startRequested = true;
+			}
 		}
 		break;
 
+	case 'g': case 'G': { // GL  ĳ  (  / )
+		const GLState::Stats& frame = GLState::getFrameStats();
+		const GLState::Stats& total = GLState::getTotalStats();
+		std::cout << "[GL ]   ȣ " << frame.issued << " /  " << frame.skipped()
+			<< " (program " << frame.skippedPrograms << ", VAO " << frame.skippedVAOs
+			<< ", activeTexture " << frame.skippedActive << ", texture " << frame.skippedTextures
+			<< ", uniform " << frame.skippedUniforms << "), draw " << frame.drawCalls << " / ﰢ " << frame.triangles << std::endl;
+		std::cout << "[GL ]  ȣ " << total.issued << " /  " << total.skipped() << std::endl;
+		break;
+	}
+
+	case 'l': case 'L': // ͳ :   <-> ǽð  (񱳿)
+		Tunnel::setLightmapEnabled(!Tunnel::isLightmapEnabled());
+		std::cout << "[ͳ] " << (Tunnel::isLightmapEnabled() ? " " : "ǽð ") << std::endl;
+		break;
+
+	case 'r': case 'R': //  ػ ѱ/ ( â ػ ״)
+		DynamicResolution::setEnabled(!DynamicResolution::isEnabled());
+		std::cout << "[ ػ] " << (DynamicResolution::isEnabled() ? "" : "")
+			<< " ( " << DynamicResolution::getScale() << ",  " << DynamicResolution::getSmoothedFrameMs() << "ms)" << std::endl;
+		break;
+
+	case 'p': case 'P': // GPU  ð 
+		g_showGpuProfiler = !g_showGpuProfiler;
+		break;
+
+	case 't': case 'T': { // ֱ CPU  Chrome trace JSON (chrome://tracing, ui.perfetto.dev)
+		char path[64];
+		snprintf(path, sizeof(path), "trace_%lld.json", (long long)time(NULL));
+		CpuProfiler::dump(path, g_traceSeconds);
+		break;
+	}
+
 	case 'q': case 'Q': // 
 		std::cout << "α׷ " << std::endl;
-		Character::cleanup();
-		exit(0);
+		Shutdown(0);
 		break;
 	}
 	glutPostRedisplay();
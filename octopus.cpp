@@ -1,4 +1,8 @@
 #include "octopus.h"
+#include "gl_state.h"
+#include "render_queue.h"
+#include "light_grid.h"
+#include "cpu_profiler.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -6,12 +10,13 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
 
-#include <gl/glew.h>
-#include <gl/freeglut.h>
-#include <gl/glm/glm.hpp>
-#include <gl/glm/ext.hpp>
-#include <gl/glm/gtc/matrix_transform.hpp>
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 // [ü] 3D  (Vertex) ϳ   
 // ġ(x,y,z), (r,g,b), (nx,ny,nz) մϴ.
@@ -26,20 +31,34 @@ namespace Enemy {
     // ---   (     ) ---
     static GLuint g_vao = 0; //   VAO (Vertex Array Object)
     static GLuint g_vbo = 0; //   VBO (Vertex Buffer Object)
-    static GLuint g_shaderProg = 0; //  ̴ α׷ ID
+    static const ShaderProgram* g_shader = nullptr;     // :  
+    static const ShaderProgram* g_elecShader = nullptr; // :  + νϽ + νϽ  
     static int g_vertexCount = 0;   //     
 
-    //  ġ   
-    static glm::vec3 g_pos = glm::vec3(0.0f, 0.0f, 30.0f); // ʱ ġ: ÷̾ (Z=20)
-    static float g_rotation = -180.0f; // ʱ ȸ: ڸ   (÷̾ ٶ)
     static float g_scale = 3.0f;      // ũ: 3 Ȯ (Ŵ )
 
-    //    
-    static std::vector<Electricity> g_electricAttacks; // ߻ ٵ ϴ Ʈ
-    static float g_attackTimer = 0.0f; //  Ÿ  Ÿ̸
     static GLuint g_elecVAO = 0; // (ť)  VAO
     static GLuint g_elecVBO = 0; // (ť)  VBO
-    static float g_mapWidthForAtk = 5.0f;
+
+    //  νϽ (Ȱ  θ   instanced draw ׸)
+    struct ElecInstance {
+        glm::mat4 model;   // 3~6 Ӽ
+        glm::vec3 color;   // 7 Ӽ
+        glm::mat3 normal;  // 9~11 Ӽ (   )
+    };
+    static const size_t INITIAL_ELEC_INSTANCES = 64;
+    static GLuint g_elecInstanceVBO = 0;
+    static size_t g_elecInstanceCapacity = 0;           // GPU  ũ (νϽ )
+    static std::vector<ElecInstance> g_elecInstances;    //   
+
+    static const float ELEC_LIGHT_RADIUS = 4.0f;       //   ݰ
+
+    //    (AttackType )
+    static const glm::vec3 ATTACK_COLORS[] = {
+        glm::vec3(1.0f, 0.2f, 0.2f), // ATK_LOW_BAR
+        glm::vec3(1.0f, 0.2f, 0.2f), // ATK_VERTICAL
+        glm::vec3(1.0f, 0.2f, 0.2f), // ATK_HIGH_BAR
+    };
 
    
     // [Լ 1] ڿ и  Լ
@@ -141,7 +160,7 @@ namespace Enemy {
         };
 
         glGenVertexArrays(1, &g_elecVAO);
-        glBindVertexArray(g_elecVAO);
+        GLState::bindVertexArray(g_elecVAO);
         glGenBuffers(1, &g_elecVBO);
         glBindBuffer(GL_ARRAY_BUFFER, g_elecVBO);
         glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
@@ -153,23 +172,56 @@ namespace Enemy {
         glEnableVertexAttribArray(1);
         glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(6 * sizeof(float)));
         glEnableVertexAttribArray(2);
+
+        // νϽ : 3~6( ) + 7(), νϽ   
+        glGenBuffers(1, &g_elecInstanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, g_elecInstanceVBO);
+        g_elecInstanceCapacity = INITIAL_ELEC_INSTANCES;
+        glBufferData(GL_ARRAY_BUFFER, g_elecInstanceCapacity * sizeof(ElecInstance), NULL, GL_STREAM_DRAW);
+        for (int i = 0; i < 4; ++i) {
+            glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(ElecInstance),
+                (void*)(offsetof(ElecInstance, model) + i * sizeof(glm::vec4)));
+            glEnableVertexAttribArray(3 + i);
+            glVertexAttribDivisor(3 + i, 1);
+        }
+        glVertexAttribPointer(7, 3, GL_FLOAT, GL_FALSE, sizeof(ElecInstance), (void*)offsetof(ElecInstance, color));
+        glEnableVertexAttribArray(7);
+        glVertexAttribDivisor(7, 1);
+        for (int i = 0; i < 3; ++i) {
+            glVertexAttribPointer(9 + i, 3, GL_FLOAT, GL_FALSE, sizeof(ElecInstance),
+                (void*)(offsetof(ElecInstance, normal) + i * sizeof(glm::vec3)));
+            glEnableVertexAttribArray(9 + i);
+            glVertexAttribDivisor(9 + i, 1);
+        }
+
+        GLState::bindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        g_elecInstances.reserve(INITIAL_ELEC_INSTANCES);
     }
 
     
     // [Լ 4]  ʱȭ ()
 
-    bool initOctopus(const char* objPath, GLuint shaderProg) {
-        g_shaderProg = shaderProg;
-        std::vector<OctoVertex> vertices;
+    static std::vector<OctoVertex> g_loadedVertices; // loadOctopusMesh  (VBO ø )
 
-        // 1. OBJ  ε
-        if (!loadOBJ(objPath, vertices)) return false;
+    bool loadOctopusMesh(const char* objPath) {
+        PROFILE_ZONE("Enemy::loadOctopusMesh");
+        g_loadedVertices.clear();
+        return loadOBJ(objPath, g_loadedVertices);
+    }
+
+    bool createOctopusBuffers(ShaderVariants& shaders) {
+        g_shader = shaders.get(VARIANT_LIT);
+        g_elecShader = shaders.get(VARIANT_LIT | VARIANT_INSTANCED | VARIANT_INSTANCE_COLOR);
+        if (!g_shader || !g_elecShader) return false;
+        if (g_loadedVertices.empty()) return false;
+        const std::vector<OctoVertex>& vertices = g_loadedVertices;
 
         g_vertexCount = vertices.size();
 
         // 2.  VAO, VBO    
         glGenVertexArrays(1, &g_vao);
-        glBindVertexArray(g_vao);
+        GLState::bindVertexArray(g_vao);
         glGenBuffers(1, &g_vbo);
         glBindBuffer(GL_ARRAY_BUFFER, g_vbo);
         glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(OctoVertex), vertices.data(), GL_STATIC_DRAW);
@@ -182,201 +234,115 @@ namespace Enemy {
         glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(OctoVertex), (void*)(6 * sizeof(float)));
         glEnableVertexAttribArray(2);
 
+        std::vector<OctoVertex>().swap(g_loadedVertices);
+
         // 3.  ť ʱȭ  
         initElectricityCube();
         return true;
     }
 
-    // [Լ 5]   Ʈ (ٽ )
-    void updateOctopus(const glm::vec3& playerPos, float dt) {
-
-        // 1. ġ  :
-        //   ߾(X=0) յڷ Դϴ. ¿δ   ʽϴ.
-        g_pos.x = 0.0f;
-        g_pos.y = 0.0f;
-
-        float normalSpeed = 6.0f;   //  ̵ ӵ
-        float panicSpeed = 12.0f;    //   ӵ
-        float safeDistance = 15.0f; // ÷̾  Ÿ
-
-        // ÷̾ Ÿ  (Z )
-        float distance = g_pos.z - playerPos.z;
-
-        // ÷̾    ڷ  (+Z )
-        if (distance < safeDistance) {
-            g_pos.z += panicSpeed * dt;
-        }
-        else {
-            g_pos.z += normalSpeed * dt; // ҿ õõ ̵
-        }
-
-        // 2. ȸ :
-        // ׻ ÷̾ ٶ󺸵 ȸ (g_rotation) մϴ.
-        glm::vec3 lookDir = playerPos - g_pos;
-        g_rotation = glm::degrees(atan2(lookDir.x, lookDir.z));
-
-        // 3.   :
-        //  ð(2.5)  մϴ.
-        g_attackTimer += dt;
-        if (g_attackTimer > 2.0f) {
-            g_attackTimer = 0.0f;
-            Electricity elec;
-            elec.direction = glm::vec3(0.0f, 0.0f, -1.0f);
-            elec.speed = 15.0f;
-            elec.lifetime = 20.0f;
-            elec.active = true;
-
-            // [] 0, 1, 2 ϸ  (̱ )
-            int pattern = rand() % 5;
-
-            switch (pattern) {
-            case 0: // ϴ 
-                elec.type = ATK_LOW_BAR;
-                elec.position = glm::vec3(0.0f, 0.4f, g_pos.z);
-                elec.radius = g_mapWidthForAtk;
-                break;
-            case 1: //   ( ϱ)
-                elec.type = ATK_VERTICAL;
-                elec.position = glm::vec3(-g_mapWidthForAtk / 2.0f, 1.5f, g_pos.z);
-                elec.radius = g_mapWidthForAtk / 2.0f;
-                break;
-            case 2: //   ( ϱ)
-                elec.type = ATK_VERTICAL;
-                elec.position = glm::vec3(g_mapWidthForAtk / 2.0f, 1.5f, g_pos.z);
-                elec.radius = g_mapWidthForAtk / 2.0f;
-                break;
-            case 3: // ߾  ( ϱ)
-                elec.type = ATK_VERTICAL;
-                elec.position = glm::vec3(0.0f, 1.5f, g_pos.z);
-                elec.radius = g_mapWidthForAtk / 3.0f;
-				break;
-            case 4: // 2 
-                elec.type = ATK_HIGH_BAR;
-                elec.position = glm::vec3(0.0f, 1.5f, g_pos.z);
-                elec.radius = g_mapWidthForAtk;
-				break;
-            }
-            g_electricAttacks.push_back(elec);
-        }
-
-        // 4. ߻ ٵ ġ Ʈ
-        for (auto& elec : g_electricAttacks) {
-            if (elec.active) {
-                elec.position += elec.direction * elec.speed * dt;
-                elec.lifetime -= dt;
-                if (elec.lifetime <= 0.0f) elec.active = false;
-            }
-        }
-
-        // 2. [߿] Ȱ()  ޸𸮿  (  ٽ!)
-        g_electricAttacks.erase(
-            std::remove_if(g_electricAttacks.begin(), g_electricAttacks.end(),
-                [](const Electricity& e) { return !e.active; }),
-            g_electricAttacks.end()
-        );
+    bool initOctopus(const char* objPath, ShaderVariants& shaders) {
+        // 1. OBJ  ε
+        if (!loadOctopusMesh(objPath)) return false;
+        return createOctopusBuffers(shaders);
     }
 
     // [Լ 6]  ׸
     void drawOctopus() {
         if (g_vao == 0) return;
-        glUseProgram(g_shaderProg);
-        glBindVertexArray(g_vao);
-     
 
         //   : ̵ -> ȸ -> ũ
         glm::mat4 model = glm::mat4(1.0f);
-        model = glm::translate(model, g_pos);
-        model = glm::rotate(model, glm::radians(g_rotation), glm::vec3(0, 1, 0));
+        model = glm::translate(model, getOctopusRenderPosition());
+        model = glm::rotate(model, glm::radians(getOctopusRotation()), glm::vec3(0, 1, 0));
         model = glm::scale(model, glm::vec3(g_scale));
 
-        // ̴  
-        glUniformMatrix4fv(glGetUniformLocation(g_shaderProg, "model"), 1, GL_FALSE, glm::value_ptr(model));
-
-        //    ( )
-        GLuint colorLoc = glGetUniformLocation(g_shaderProg, "objectColor");
-        if (colorLoc >= 0) glUniform3f(colorLoc, 1.0f, 0.5f, 0.0f);
-
-        glDrawArrays(GL_TRIANGLES, 0, g_vertexCount);
+        //  ť Ŷ ֱ (/ flush  )
+        DrawPacket packet;
+        packet.shader = g_shader;
+        packet.vao = g_vao;
+        packet.count = g_vertexCount;
+        packet.model = model;
+        packet.color = glm::vec3(1.0f, 0.5f, 0.0f); //    ( )
+        packet.hasColor = true;
+        packet.profileScope = "octopus";
+        RenderQueue::submit(packet);
     }
 
     // --------------------------------------------------------
     // [Լ 7]  ׸
     // :  ٵ ȭ鿡 ׸ϴ.
     // Ư¡: ť긦 (X) 10 ÷  ü  ''ó ̰ ϴ.
+    // Ȱ  θ νϽ ۿ    instanced draw ׸ϴ.
+    // ( ƹ Ƶ draw call 1)
     // --------------------------------------------------------
     void drawElectricity() {
         if (g_elecVAO == 0) return;
-        glUseProgram(g_shaderProg);
-        glBindVertexArray(g_elecVAO);
-
 
-        for (const auto& elec : g_electricAttacks) {
+        g_elecInstances.clear();
+        glm::vec3 center(0.0f);
+        for (const auto& elec : getAttacks()) {
             if (!elec.active) continue;
 
+            glm::vec3 renderPos = getRenderPosition(elec);
             glm::mat4 model = glm::mat4(1.0f);
-            model = glm::translate(model, elec.position);
+            model = glm::translate(model, renderPos);
 
             if (elec.type == ATK_VERTICAL) {
-                glUniform3f(glGetUniformLocation(g_shaderProg, "objectColor"), 1.0f, 0.2f, 0.2f);
                 model = glm::rotate(model, glm::radians(90.0f), glm::vec3(0, 0, 1));
                 model = glm::scale(model, glm::vec3(3.0f, elec.radius * 2.0f, 0.3f));
             }
             else if (elec.type == ATK_LOW_BAR) {
-                glUniform3f(glGetUniformLocation(g_shaderProg, "objectColor"), 1.0f, 0.2f, 0.2f);
                 model = glm::scale(model, glm::vec3(elec.radius * 2.0f, 0.3f, 0.3f));
             }
             else if (elec.type == ATK_HIGH_BAR) {
-                glUniform3f(glGetUniformLocation(g_shaderProg, "objectColor"), 1.0f, 0.2f, 0.2f);
                 model = glm::scale(model, glm::vec3(elec.radius * 2.0f, 0.3f, 0.3f));
 			}
 
-            glUniformMatrix4fv(glGetUniformLocation(g_shaderProg, "model"), 1, GL_FALSE, glm::value_ptr(model));
-            glDrawArrays(GL_TRIANGLES, 0, 12);
+            ElecInstance inst;
+            inst.model = model;
+            inst.color = ATTACK_COLORS[elec.type];
+            inst.normal = glm::transpose(glm::inverse(glm::mat3(model)));
+            g_elecInstances.push_back(inst);
+            center += renderPos;
         }
-        glBindVertexArray(0);
+        if (g_elecInstances.empty()) return;
+
+        // ڶ   ø, ƴϸ ȭ  
+        size_t count = g_elecInstances.size();
+        glBindBuffer(GL_ARRAY_BUFFER, g_elecInstanceVBO);
+        while (g_elecInstanceCapacity < count) g_elecInstanceCapacity *= 2;
+        glBufferData(GL_ARRAY_BUFFER, g_elecInstanceCapacity * sizeof(ElecInstance), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(ElecInstance), g_elecInstances.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        DrawPacket packet;
+        packet.shader = g_elecShader;
+        packet.vao = g_elecVAO;
+        packet.count = 12;
+        packet.instanced = true;
+        packet.instanceCount = (GLsizei)count;
+        packet.instanceColor = true;
+        packet.sortCenter = center / (float)count; // Ŀ:   ġ
+        packet.profileScope = "electricity";
+        RenderQueue::submit(packet);
     }
 
-    // --------------------------------------------------------
-    // [Լ 8] 浹 üũ
-    // : ÷̾ ٿ Ҵ Ȯմϴ.
-    // : 
-    // 1. Z Ÿ  Ȯ (β üũ)
-    // 2. ÷̾ Y() Ȯ (ߴ üũ)
-    // 3.   شǸ 浹 ó
-    // --------------------------------------------------------
-    bool checkElectricityCollision(const glm::vec3& playerPos, float playerRadius, PlayerStun& outStun) {
-        for (auto& elec : g_electricAttacks) {
+    //   (drawElectricity  , ׸  LightGrid )
+    void submitLights() {
+        for (const auto& elec : getAttacks()) {
             if (!elec.active) continue;
-            float zDist = abs(elec.position.z - playerPos.z);
-            if (zDist > 0.5f) continue;
-
-            bool collision = false;
-            switch (elec.type) {
-            case ATK_LOW_BAR:
-                if (playerPos.y < 0.5f) collision = true; //  
-                break;
-            case ATK_VERTICAL:
-                if (playerPos.x > elec.position.x - elec.radius && playerPos.x < elec.position.x + elec.radius) collision = true;
-                break;
-			case ATK_HIGH_BAR:
-				if (playerPos.y < 1.5f) collision = true; // 2  
-            }
-
-            if (collision) {
-                outStun.isStunned = true;
-                outStun.stunDuration = 1.5f;
-                outStun.stunTimer = 0.0f;
-                elec.active = false;
-                return true;
-            }
+            LightGrid::addPointLight(getRenderPosition(elec), ATTACK_COLORS[elec.type], ELEC_LIGHT_RADIUS);
         }
-        return false;
     }
 
     void cleanup() {
         if (g_vbo) glDeleteBuffers(1, &g_vbo);
-        if (g_vao) glDeleteVertexArrays(1, &g_vao);
+        if (g_vao) { GLState::forgetVertexArray(g_vao); glDeleteVertexArrays(1, &g_vao); }
         if (g_elecVBO) glDeleteBuffers(1, &g_elecVBO);
-        if (g_elecVAO) glDeleteVertexArrays(1, &g_elecVAO);
+        if (g_elecInstanceVBO) glDeleteBuffers(1, &g_elecInstanceVBO);
+        g_elecInstanceVBO = 0;
+        g_elecInstanceCapacity = 0;
+        if (g_elecVAO) { GLState::forgetVertexArray(g_elecVAO); glDeleteVertexArrays(1, &g_elecVAO); }
     }
 }
\ No newline at end of file
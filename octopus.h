@@ -1,36 +1,24 @@
 #pragma once
 #include <vector>
-#include <gl/glew.h>
-#include <gl/glm/glm.hpp>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
 #include "character.h"
+#include "shader_program.h"
+#include "octopus_sim.h"
 
-enum AttackType {
-    ATK_LOW_BAR,    // ϴ (1)
-    ATK_VERTICAL,    //  (¿/߾ ̵)
-    ATK_HIGH_BAR     //
-};
-
-//   ü
-struct Electricity {
-    glm::vec3 position;
-    glm::vec3 direction;
-    float speed;
-    float lifetime;
-    float maxLifetime;
-    float radius;
-    bool active;
-	AttackType type;
-};
-
-//    Լ
+//   ׸ (޽/VAO,  νϽ, ). ¿  octopus_sim.h
 namespace Enemy {
-    // OBJ  θ ڷ ޽ϴ.
-    bool initOctopus(const char* objPath, GLuint shaderProg);
+    // OBJ  θ ڷ ޽ϴ. ̴ shaders ʿ  ޾ 
+    bool initOctopus(const char* objPath, ShaderVariants& shaders);
+    // initOctopus 񵿱 ε   ܰ
+    bool loadOctopusMesh(const char* objPath);               // ۾ : OBJ Ľ̸ (GL ȣ )
+    bool createOctopusBuffers(ShaderVariants& shaders);      //  : Ľ  VBO ø
 
-    void updateOctopus(const glm::vec3& playerPos, float dt);
+    // ׸ updateOctopus  ¸ б⸸  (Ӵ  )
     void drawOctopus();
     void drawElectricity();
-    bool checkElectricityCollision(const glm::vec3& playerPos, float playerRadius, PlayerStun& outStun);
+    // ư ٸ  ϳ LightGrid  (ֺ /ٴ   )
+    void submitLights();
 
     void cleanup();
-}
\ No newline at end of file
+}
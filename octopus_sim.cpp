@@ -0,0 +1,215 @@
+#include "octopus_sim.h"
+#include "world.h"
+#include "cpu_profiler.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+
+//  AI /    / 浹 (GL )
+// ׸(octopus.cpp) 帮    
+
+namespace Enemy {
+
+    //  ġ   
+    static glm::vec3 g_pos = glm::vec3(0.0f, 0.0f, 30.0f); // ʱ ġ: ÷̾ (Z=20)
+    static glm::vec3 g_prevPos = g_pos;  //   ġ ( )
+    static float g_renderAlpha = 1.0f;   // ׸    ->    
+    static float g_rotation = -180.0f; // ʱ ȸ: ڸ   (÷̾ ٶ)
+
+    //    
+    static std::vector<Electricity> g_electricAttacks; // ߻ ٵ ϴ Ʈ
+    static float g_attackTimer = 0.0f; //  Ÿ  Ÿ̸
+    static float g_mapWidthForAtk = 5.0f;
+    static int (*g_patternSource)(float z) = nullptr; // ڽ   (World::startRun )
+
+    // ó · ( ߼  30m,  )
+    void resetState() {
+        g_pos = glm::vec3(0.0f, 0.0f, 30.0f);
+        g_prevPos = g_pos;
+        g_renderAlpha = 1.0f;
+        g_rotation = -180.0f;
+        g_electricAttacks.clear();
+        g_attackTimer = 0.0f;
+    }
+
+    // [Լ 5]   Ʈ (ٽ )
+    void updateOctopus(const glm::vec3& playerPos, float dt) {
+        PROFILE_ZONE("Enemy::updateOctopus");
+        g_prevPos = g_pos;
+
+        // 1. ġ  :
+        //   ߾(X=0) յڷ Դϴ. ¿δ   ʽϴ.
+        g_pos.x = 0.0f;
+        g_pos.y = 0.0f;
+
+        float normalSpeed = 6.0f;   //  ̵ ӵ
+        float panicSpeed = 12.0f;    //   ӵ
+        float safeDistance = 15.0f; // ÷̾  Ÿ
+
+        // ÷̾ Ÿ  (Z )
+        float distance = g_pos.z - playerPos.z;
+
+        // ÷̾    ڷ  (+Z )
+        if (distance < safeDistance) {
+            g_pos.z += panicSpeed * dt;
+        }
+        else {
+            g_pos.z += normalSpeed * dt; // ҿ õõ ̵
+        }
+
+        // 2. ȸ :
+        // ׻ ÷̾ ٶ󺸵 ȸ (g_rotation) մϴ.
+        glm::vec3 lookDir = playerPos - g_pos;
+        g_rotation = glm::degrees(atan2(lookDir.x, lookDir.z));
+
+        // 3.   :
+        //  ð(2.5)  մϴ.
+        g_attackTimer += dt;
+        if (g_attackTimer > 2.0f) {
+            g_attackTimer = 0.0f;
+            Electricity elec;
+            elec.direction = glm::vec3(0.0f, 0.0f, -1.0f);
+            elec.speed = 15.0f;
+            elec.lifetime = 20.0f;
+            elec.active = true;
+
+            // [] 0, 1, 2 ϸ  (̱ )
+            //  ڽ  ( õ Ӱ 帮  )
+            int pattern = g_patternSource ? g_patternSource(g_pos.z) : 0;
+
+            switch (pattern) {
+            case 0: // ϴ 
+                elec.type = ATK_LOW_BAR;
+                elec.position = glm::vec3(0.0f, 0.4f, g_pos.z);
+                elec.radius = g_mapWidthForAtk;
+                break;
+            case 1: //   ( ϱ)
+                elec.type = ATK_VERTICAL;
+                elec.position = glm::vec3(-g_mapWidthForAtk / 2.0f, 1.5f, g_pos.z);
+                elec.radius = g_mapWidthForAtk / 2.0f;
+                break;
+            case 2: //   ( ϱ)
+                elec.type = ATK_VERTICAL;
+                elec.position = glm::vec3(g_mapWidthForAtk / 2.0f, 1.5f, g_pos.z);
+                elec.radius = g_mapWidthForAtk / 2.0f;
+                break;
+            case 3: // ߾  ( ϱ)
+                elec.type = ATK_VERTICAL;
+                elec.position = glm::vec3(0.0f, 1.5f, g_pos.z);
+                elec.radius = g_mapWidthForAtk / 3.0f;
+				break;
+            case 4: // 2 
+                elec.type = ATK_HIGH_BAR;
+                elec.position = glm::vec3(0.0f, 1.5f, g_pos.z);
+                elec.radius = g_mapWidthForAtk;
+				break;
+            }
+            elec.prevPosition = elec.position;
+            g_electricAttacks.push_back(elec);
+        }
+
+        // 4. ߻ ٵ ġ Ʈ
+        for (auto& elec : g_electricAttacks) {
+            if (elec.active) {
+                elec.prevPosition = elec.position;
+                elec.position += elec.direction * elec.speed * dt;
+                elec.lifetime -= dt;
+                if (elec.lifetime <= 0.0f) elec.active = false;
+            }
+        }
+
+        // 2. [߿] Ȱ()  ޸𸮿  (  ٽ!)
+        g_electricAttacks.erase(
+            std::remove_if(g_electricAttacks.begin(), g_electricAttacks.end(),
+                [](const Electricity& e) { return !e.active; }),
+            g_electricAttacks.end()
+        );
+    }
+
+    void interpolate(float alpha) {
+        g_renderAlpha = alpha;
+    }
+
+    glm::vec3 getOctopusRenderPosition() {
+        return glm::mix(g_prevPos, g_pos, g_renderAlpha);
+    }
+
+    float getOctopusRotation() {
+        return g_rotation;
+    }
+
+    const std::vector<Electricity>& getAttacks() {
+        return g_electricAttacks;
+    }
+
+    glm::vec3 getRenderPosition(const Electricity& elec) {
+        return glm::mix(elec.prevPosition, elec.position, g_renderAlpha);
+    }
+
+    // --------------------------------------------------------
+    // [Լ 8] 浹 üũ
+    // : ÷̾ ٿ Ҵ Ȯմϴ.
+    // : 
+    // 1. Z Ÿ  Ȯ (β üũ)
+    // 2. ÷̾ Y() Ȯ (ߴ üũ)
+    // 3.   شǸ 浹 ó
+    // --------------------------------------------------------
+    bool checkElectricityCollision(const glm::vec3& playerPos, float playerRadius, PlayerStun& outStun) {
+        PROFILE_ZONE("Enemy::checkElectricityCollision");
+        for (auto& elec : g_electricAttacks) {
+            if (!elec.active) continue;
+            float zDist = abs(elec.position.z - playerPos.z);
+            if (zDist > 0.5f) continue;
+
+            bool collision = false;
+            switch (elec.type) {
+            case ATK_LOW_BAR:
+                if (playerPos.y < 0.5f) collision = true; //  
+                break;
+            case ATK_VERTICAL:
+                if (playerPos.x > elec.position.x - elec.radius && playerPos.x < elec.position.x + elec.radius) collision = true;
+                break;
+			case ATK_HIGH_BAR:
+				if (playerPos.y < 1.5f) collision = true; // 2  
+            }
+
+            if (collision) {
+                outStun.isStunned = true;
+                outStun.stunDuration = 1.5f;
+                outStun.stunTimer = 0.0f;
+                elec.active = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void setAttackPatternSource(int (*source)(float z)) {
+        g_patternSource = source;
+    }
+
+    void shiftOrigin(float dz) {
+        g_pos.z += dz;
+        g_prevPos.z += dz;
+        for (auto& elec : g_electricAttacks) {
+            elec.position.z += dz;
+            elec.prevPosition.z += dz;
+        }
+    }
+
+    unsigned int hashState(unsigned int h) {
+        h = World::hashBytes(h, &g_pos, sizeof(g_pos));
+        h = World::hashBytes(h, &g_rotation, sizeof(g_rotation));
+        h = World::hashBytes(h, &g_attackTimer, sizeof(g_attackTimer));
+        for (const auto& elec : g_electricAttacks) {
+            h = World::hashBytes(h, &elec.position, sizeof(elec.position));
+            h = World::hashBytes(h, &elec.lifetime, sizeof(elec.lifetime));
+            h = World::hashBytes(h, &elec.active, sizeof(elec.active));
+            h = World::hashBytes(h, &elec.type, sizeof(elec.type));
+        }
+        return h;
+    }
+}
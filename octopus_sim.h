@@ -0,0 +1,48 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+#include "character_sim.h"
+
+//  AI /    (GL ): octopus_sim.cpp
+// (octopus.cpp ׸⸦ ) 帮    
+
+enum AttackType {
+    ATK_LOW_BAR,    // ϴ (1)
+    ATK_VERTICAL,    //  (¿/߾ ̵)
+    ATK_HIGH_BAR     //
+};
+
+//   ü
+struct Electricity {
+    glm::vec3 position;
+    glm::vec3 prevPosition;   //   ġ ( )
+    glm::vec3 direction;
+    float speed;
+    float lifetime;
+    float maxLifetime;
+    float radius;
+    bool active;
+	AttackType type;
+};
+
+namespace Enemy {
+    //   · ( ġ,  ,  Ÿ̸)
+    void resetState();
+    void updateOctopus(const glm::vec3& playerPos, float dt);   //     (World::update)
+    void interpolate(float alpha);   // ׸ ġ =     alpha (0~1), ׸  Ӵ  
+    bool checkElectricityCollision(const glm::vec3& playerPos, float playerRadius, PlayerStun& outStun);
+
+    // ׸ ȸ ( ġ)
+    glm::vec3 getOctopusRenderPosition();
+    float getOctopusRotation();   //  
+    const std::vector<Electricity>& getAttacks();
+    glm::vec3 getRenderPosition(const Electricity& elec);
+
+    //   :  ġ( z) ڽ (0~4) ޾ƿ (World::startRun Course )
+    void setAttackPatternSource(int (*source)(float z));
+    // ÷ :   Z dzŭ ű
+    void shiftOrigin(float dz);
+
+    //  : / ¸ h   (World::checksum)
+    unsigned int hashState(unsigned int h);
+}
@@ -0,0 +1,129 @@
+#include "portrait.h"
+#include "character.h"
+#include "render_queue.h"
+#include "light_grid.h"
+#include "gl_state.h"
+#include <iostream>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Portrait {
+
+    static GLuint g_fbo = 0;
+    static GLuint g_colorTexture = 0;
+    static GLuint g_depthBuffer = 0;
+    static int g_size = 0;
+    static int g_updateInterval = 1;
+
+    static unsigned int g_frame = 0;
+    static unsigned int g_lastRenderFrame = 0;
+    static unsigned int g_lastPoseVersion = 0;
+    static bool g_valid = false;       //  ̶ ׷ȴ
+    static int g_renderCount = 0;
+
+    bool init(int size, int updateInterval) {
+        g_size = size;
+        g_updateInterval = (updateInterval < 1) ? 1 : updateInterval;
+
+        glGenTextures(1, &g_colorTexture);
+        GLState::bindTexture(GL_TEXTURE_2D, g_colorTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        GLState::bindTexture(GL_TEXTURE_2D, 0);
+
+        glGenRenderbuffers(1, &g_depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, g_depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &g_fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, g_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_colorTexture, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, g_depthBuffer);
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "ʻȭ FBO  : 0x" << std::hex << status << std::dec << std::endl;
+            cleanup();
+            return false;
+        }
+        g_valid = false;
+        return true;
+    }
+
+    void cleanup() {
+        if (g_fbo) glDeleteFramebuffers(1, &g_fbo);
+        if (g_depthBuffer) glDeleteRenderbuffers(1, &g_depthBuffer);
+        if (g_colorTexture) {
+            GLState::forgetTexture(g_colorTexture);
+            glDeleteTextures(1, &g_colorTexture);
+        }
+        g_fbo = 0;
+        g_depthBuffer = 0;
+        g_colorTexture = 0;
+        g_valid = false;
+    }
+
+    void update(const CameraBlock& lighting, const glm::vec3& characterPos, int winW, int winH) {
+        g_frame++;
+        if (g_fbo == 0) return;
+
+        unsigned int pose = Character::getPoseVersion();
+        if (g_valid) {
+            if (pose == g_lastPoseVersion) return;                       // ڼ ״
+            if (g_frame - g_lastRenderFrame < (unsigned int)g_updateInterval) return; //    
+        }
+
+        // ʻȭ ī޶ (ĳ͸ ٴϹǷ ̵ ٽ ׸  ƴ)
+        glm::vec3 uiCamPos = characterPos + glm::vec3(0.0f, 0.9f, 1.0f);
+        glm::vec3 uiCamTarget = characterPos + glm::vec3(0.0f, 0.9f, 0.0f);
+        glm::mat4 uiView = glm::lookAt(uiCamPos, uiCamTarget, glm::vec3(0, 1, 0));
+        glm::mat4 uiProj = glm::ortho(-0.8f, 0.8f, -0.8f, 0.8f, 0.1f, 10.0f);
+
+        // ʻȭ :  ״ ΰ ī޶ ٲ㼭 UBO   
+        CameraBlock portraitCamera = lighting;
+        portraitCamera.view = uiView;
+        portraitCamera.projection = uiProj;
+        portraitCamera.viewPos = glm::vec4(uiCamPos, 1.0f);
+        // Ŭ ڴ  ȭ ũ ̶ ʻȭ   ( )
+        LightGrid::disable(portraitCamera);
+        CameraUBO::update(portraitCamera);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, g_fbo);
+        glViewport(0, 0, g_size, g_size);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f); //   (ռ   ȭ ħ)
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glEnable(GL_DEPTH_TEST);
+
+        RenderQueue::begin(uiView);
+        Character::submitRobot();
+        RenderQueue::flush();
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, winW, winH);
+
+        g_lastPoseVersion = pose;
+        g_lastRenderFrame = g_frame;
+        g_valid = true;
+        g_renderCount++;
+    }
+
+    GLuint getTexture() {
+        return g_valid ? g_colorTexture : 0;
+    }
+
+    void setUpdateInterval(int frames) {
+        g_updateInterval = (frames < 1) ? 1 : frames;
+    }
+
+    int getRenderCount() {
+        return g_renderCount;
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "shader_program.h"
+
+// ĳ ʻȭ (ȭ   â)
+// κ  ũ FBO ؽó ׷ ΰ, ȭ鿡 ؽó 簢θ Դϴ.
+// ڼ ٲ , ׸ ּ updateInterval  θ ٽ ׸
+// ùķ̼  ʽϴ (Character::submitRobot ).
+namespace Portrait {
+    bool init(int size, int updateInterval);
+    void cleanup();
+
+    // ʿϸ FBO ٽ ׸.  ⺻ ӹۿ (0,0,winW,winH) Ʈ  ϴ.
+    // lighting:   ī޶  ( ״  ī޶ ٲ)
+    void update(const CameraBlock& lighting, const glm::vec3& characterPos, int winW, int winH);
+
+    GLuint getTexture();
+    void setUpdateInterval(int frames); // 1 = ڼ ٲ Ӹ
+    int getRenderCount();               // ݱ FBO ٽ ׸ Ƚ
+}
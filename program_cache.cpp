@@ -0,0 +1,156 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "program_cache.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace ProgramCache {
+
+    static const char CACHE_DIR[] = "shader_cache";
+    static const char CACHE_MAGIC[4] = { 'P', 'B', 'I', 'N' };
+    static const uint32_t CACHE_VERSION = 1;   //   ٲ ø (Ű )
+
+    //  Ӹ (ڿ length Ʈ ̳ʸ)
+    struct CacheHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t binaryFormat;
+        uint32_t length;
+        uint64_t key;          //  ̸  Ű (ؽ 浹/̸ ٲ Ȯο)
+    };
+
+    static bool g_enabled = true;
+    static int g_available = -1;   // -1:  Ȯ  
+
+    void setEnabled(bool enabled) {
+        g_enabled = enabled;
+    }
+
+    bool isAvailable() {
+        if (!g_enabled) return false;
+        if (g_available < 0) {
+            GLint formats = 0;
+            if (GLEW_ARB_get_program_binary) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            g_available = (formats > 0) ? 1 : 0;
+            if (!g_available) std::cout << "[̴ ĳ] α׷ ̳ʸ  ʾ ҽ ϸ " << std::endl;
+        }
+        return g_available == 1;
+    }
+
+    // FNV-1a 64Ʈ
+    static void hashBytes(uint64_t& h, const void* data, size_t size) {
+        const unsigned char* p = (const unsigned char*)data;
+        for (size_t i = 0; i < size; ++i) {
+            h ^= p[i];
+            h *= 0x100000001b3ULL;
+        }
+    }
+
+    static void hashString(uint64_t& h, const char* s) {
+        if (s) hashBytes(h, s, strlen(s));
+        hashBytes(h, "\0", 1); //  (ڿ 谡 ޶  Ű  ʰ)
+    }
+
+    uint64_t makeKey(const char* const* sources, int count) {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        hashBytes(h, &CACHE_VERSION, sizeof(CACHE_VERSION));
+        hashString(h, (const char*)glGetString(GL_VENDOR));
+        hashString(h, (const char*)glGetString(GL_RENDERER));
+        hashString(h, (const char*)glGetString(GL_VERSION));
+        for (int i = 0; i < count; ++i) hashString(h, sources[i]);
+        return h;
+    }
+
+    static std::string cachePath(uint64_t key) {
+        char name[64];
+        snprintf(name, sizeof(name), "%s/%016llx.bin", CACHE_DIR, (unsigned long long)key);
+        return name;
+    }
+
+    bool load(GLuint program, uint64_t key) {
+        if (!isAvailable()) return false;
+
+        std::string path = cachePath(key);
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) return false;   // cache miss
+
+        CacheHeader header;
+        std::vector<char> binary;
+        bool ok = fread(&header, sizeof(header), 1, f) == 1
+            && memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0
+            && header.version == CACHE_VERSION
+            && header.key == key
+            && header.length > 0;
+        if (ok) {
+            binary.resize(header.length);
+            ok = fread(binary.data(), header.length, 1, f) == 1;
+        }
+        fclose(f);
+
+        if (ok) {
+            glProgramBinary(program, (GLenum)header.binaryFormat, binary.data(), (GLsizei)header.length);
+            GLint linked = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &linked);
+            ok = (linked == GL_TRUE);
+        }
+        if (!ok) {
+            // ̹ ź߰ų  :  ҽ   ٽ ǰ
+            std::cout << "[̴ ĳ] ̳ʸ  Ұ, ٽ : " << path << std::endl;
+            remove(path.c_str());
+        }
+        return ok;
+    }
+
+    void prepareForLink(GLuint program) {
+        if (isAvailable()) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    void store(GLuint program, uint64_t key) {
+        if (!isAvailable()) return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) return;
+
+        std::vector<char> binary(length);
+        GLenum format = 0;
+        GLsizei written = 0;
+        glGetProgramBinary(program, length, &written, &format, binary.data());
+        if (written <= 0) return;
+
+#ifdef _WIN32
+        _mkdir(CACHE_DIR);
+#else
+        mkdir(CACHE_DIR, 0755);
+#endif
+
+        CacheHeader header;
+        memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.binaryFormat = (uint32_t)format;
+        header.length = (uint32_t)written;
+        header.key = key;
+
+        // ӽ Ͽ    ٲġ (߰ ܵ  ĳð  ʰ)
+        std::string path = cachePath(key);
+        std::string tempPath = path + ".tmp";
+        FILE* f = fopen(tempPath.c_str(), "wb");
+        if (!f) return;
+        bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+            && fwrite(binary.data(), written, 1, f) == 1;
+        ok = (fclose(f) == 0) && ok;
+        if (ok) {
+            remove(path.c_str());
+            ok = rename(tempPath.c_str(), path.c_str()) == 0;
+        }
+        if (!ok) remove(tempPath.c_str());
+    }
+}
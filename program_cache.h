@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <GL/glew.h>
+
+// ũ ̴ α׷ ̳ʸ ũ ĳ (glGetProgramBinary / glProgramBinary)
+// Ű = ̴ ҽ ü + GL_VENDOR / GL_RENDERER / GL_VERSION ؽ
+// ҽ ̹ ٲ Ű ޶ ڿ  ϵ˴ϴ.
+// Ȯ ų ̳ʸ źεǸ ȣ  ҽ Ϸ ư ˴ϴ.
+// ShaderProgram::build ϹǷ  α׷(, ,  ߰Ǵ н)  ĳõ˴ϴ.
+namespace ProgramCache {
+    // ҽ (, ׸Ʈ )  ̹  Ű 
+    uint64_t makeKey(const char* const* sources, int count);
+
+    // ĳÿ program ̳ʸ ø. (ũ  OK)ϸ true
+    bool load(GLuint program, uint64_t key);
+
+    // ũ  program ̳ʸ  (ũ  prepareForLink ҷ  )
+    void store(GLuint program, uint64_t key);
+    void prepareForLink(GLuint program);
+
+    void setEnabled(bool enabled);   // --no-shader-cache
+    bool isAvailable();              //   + ̹ ̳ʸ  ϳ ̻ 
+}
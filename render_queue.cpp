@@ -0,0 +1,163 @@
+#include "render_queue.h"
+#include "gl_state.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+#include <vector>
+#include <algorithm>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+DrawPacket::DrawPacket()
+    : pass(PASS_OPAQUE), shader(nullptr), vao(0), texture(0), lightmap(0), lightmapRect(0.0f, 0.0f, 1.0f, 1.0f),
+      instanced(false), instanceColor(false), indexed(false),
+      first(0), count(0), instanceCount(1), model(1.0f), color(1.0f), hasColor(false), sortCenter(0.0f),
+      bones(nullptr), boneCount(0), profileScope(nullptr) {
+}
+
+namespace RenderQueue {
+
+    static const float MAX_SORT_DEPTH = 256.0f;      // ̺  ü  ̷ 
+    static const uint64_t DEPTH_MASK = 0xFFFFFFull;  // 24Ʈ = Ŷ( 8Ʈ, 1m) + Ŷ  ( 16Ʈ)
+    static const uint64_t FINE_DEPTH_MASK = 0xFFFFull;
+    static const uint64_t ID_MASK = 0xFFFull;        // 12Ʈ
+
+    struct QueueItem {
+        uint64_t key;
+        size_t packetIndex;
+    };
+
+    static glm::mat4 g_view(1.0f);
+    static std::vector<DrawPacket> g_packets;  //    (뷮 )
+    static std::vector<QueueItem> g_items;
+    static int g_lastPacketCount = 0;
+    static glm::mat3 g_boneNormals[MAX_BONES];
+
+    uint64_t makeSortKey(RenderPass pass, GLuint program, GLuint vao, GLuint texture, float depth) {
+        float d = depth / MAX_SORT_DEPTH;
+        if (d < 0.0f) d = 0.0f;
+        if (d > 1.0f) d = 1.0f;
+        // ģ Ŷ  ID  ־ VAO  ͳ ûũ աڷ ׷ (early-z)
+        //  Ŷ ȿ α׷/VAO/ؽó 
+        uint64_t depthBits = (uint64_t)(d * (float)DEPTH_MASK);
+        //  ڡ̾ ϹǷ ̸ 
+        if (pass == PASS_TRANSPARENT) depthBits = DEPTH_MASK - depthBits;
+        uint64_t bucket = depthBits >> 16;
+        uint64_t fine = depthBits & FINE_DEPTH_MASK;
+
+        return ((uint64_t)pass << 60)
+            | (bucket << 52)
+            | (((uint64_t)program & ID_MASK) << 40)
+            | (((uint64_t)vao & ID_MASK) << 28)
+            | (((uint64_t)texture & ID_MASK) << 16)
+            | fine;
+    }
+
+    void begin(const glm::mat4& view) {
+        g_view = view;
+        g_packets.clear();
+        g_items.clear();
+    }
+
+    void submit(const DrawPacket& packet) {
+        // ī޶   (ī޶  -Z)
+        glm::vec4 viewPos = g_view * (packet.model * glm::vec4(packet.sortCenter, 1.0f));
+        float depth = -viewPos.z;
+
+        GLuint program = packet.shader ? packet.shader->id() : 0;
+        QueueItem item;
+        item.key = makeSortKey(packet.pass, program, packet.vao, packet.texture, depth);
+        item.packetIndex = g_packets.size();
+        g_packets.push_back(packet);
+        g_items.push_back(item);
+    }
+
+    void submitCallback(RenderPass pass, const std::function<void()>& callback, const char* profileScope) {
+        DrawPacket packet;
+        packet.pass = pass;
+        packet.callback = callback;
+        packet.profileScope = profileScope;
+
+        // н Ʈ θ Ŷ/ID/̰  0̶ ڱ н  տ 
+        QueueItem item;
+        item.key = (uint64_t)pass << 60;
+        item.packetIndex = g_packets.size();
+        g_packets.push_back(packet);
+        g_items.push_back(item);
+    }
+
+    static void execute(const DrawPacket& p) {
+        if (p.callback) {
+            p.callback();
+            return;
+        }
+        if (!p.shader) return;
+
+        // ε/uniform ߺ GLState ShaderProgram ĳð ɷ 
+        p.shader->use();
+        GLState::bindVertexArray(p.vao);
+        if (p.texture) {
+            GLState::activeTexture(GL_TEXTURE0);
+            GLState::bindTexture(GL_TEXTURE_2D, p.texture);
+            p.shader->setInt(U_WALL_TEXTURE, 0);
+        }
+        if (p.lightmap) {
+            GLState::activeTexture(GL_TEXTURE0 + LIGHTMAP_UNIT);
+            GLState::bindTexture(GL_TEXTURE_2D, p.lightmap);
+            GLState::activeTexture(GL_TEXTURE0);
+            p.shader->setVec4(U_LIGHTMAP_RECT, p.lightmapRect);
+        }
+        if (p.boneCount > 0) {
+            // 븶  ĵ CPU (̴  inverse  ʵ)
+            int count = (p.boneCount < MAX_BONES) ? p.boneCount : MAX_BONES;
+            for (int i = 0; i < count; ++i) g_boneNormals[i] = glm::transpose(glm::inverse(glm::mat3(p.bones[i])));
+            p.shader->setMat4Array(U_BONES, p.bones, count);
+            p.shader->setMat3Array(U_BONE_NORMALS, g_boneNormals, count);
+        }
+        p.shader->setMat4(U_MODEL, p.model);
+        if (p.shader->location(U_NORMAL_MATRIX) >= 0)
+            p.shader->setMat3(U_NORMAL_MATRIX, glm::transpose(glm::inverse(glm::mat3(p.model))));
+        if (p.hasColor) p.shader->setVec3(U_OBJECT_COLOR, p.color);
+
+        if (p.indexed) {
+            const void* offset = (const void*)(p.first * sizeof(unsigned int));
+            if (p.instanced) glDrawElementsInstanced(GL_TRIANGLES, p.count, GL_UNSIGNED_INT, offset, p.instanceCount);
+            else glDrawElements(GL_TRIANGLES, p.count, GL_UNSIGNED_INT, offset);
+        }
+        else {
+            if (p.instanced) glDrawArraysInstanced(GL_TRIANGLES, p.first, p.count, p.instanceCount);
+            else glDrawArrays(GL_TRIANGLES, p.first, p.count);
+        }
+        GLState::countDraw((unsigned long long)(p.count / 3) * (p.instanced ? p.instanceCount : 1));
+    }
+
+    void flush() {
+        PROFILE_ZONE("RenderQueue::flush");
+        // Ű     (  Ӹó  ִ ǰ)
+        std::stable_sort(g_items.begin(), g_items.end(),
+            [](const QueueItem& a, const QueueItem& b) { return a.key < b.key; });
+
+        // ʻȭó ٱ    쿡   
+        const bool scoped = !GpuProfiler::inScope();
+        const char* scope = nullptr;
+        for (const auto& item : g_items) {
+            const DrawPacket& p = g_packets[item.packetIndex];
+            if (scoped && p.profileScope != scope) {
+                if (scope) GpuProfiler::end();
+                scope = p.profileScope;
+                if (scope) GpuProfiler::begin(scope);
+            }
+            execute(p);
+        }
+        if (scope) GpuProfiler::end();
+        GLState::bindVertexArray(0);
+
+        g_lastPacketCount = (int)g_items.size();
+        g_packets.clear();
+        g_items.clear();
+    }
+
+    int getLastPacketCount() {
+        return g_lastPacketCount;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "shader_program.h"
+
+// ׸ н ( Ű ֻ Ʈ)
+enum RenderPass {
+    PASS_OPAQUE = 0,      // : º    ȿ ա
+    PASS_TRANSPARENT = 1  // : ڡ ( / ݹ鵵 )
+};
+
+//   draw call ʿ 
+//  ٷ ׸ ʰ  Ŷ ť ֱ⸸ մϴ.
+struct DrawPacket {
+    RenderPass pass;
+    const ShaderProgram* shader; // Ŷ ´  (ShaderVariants::get)
+    GLuint vao;
+    GLuint texture;          // 0 ̸ ε   (VARIANT_TEXTURED ̴ ǹ )
+    GLuint lightmap;         //   Ʋ (VARIANT_LIGHTMAPPED), 0 ̸ ε  
+    glm::vec4 lightmapRect;  // Ʋ   (u0, v0, , )
+    bool instanced;          // glDraw*Instanced (̴ VARIANT_INSTANCED)
+    bool instanceColor;      // 7 Ӽ νϽ  (̴ VARIANT_INSTANCE_COLOR)
+    bool indexed;            // glDrawElements (GL_UNSIGNED_INT) / glDrawArrays
+    GLsizei first;           //   Ǵ  ε
+    GLsizei count;
+    GLsizei instanceCount;
+    glm::mat4 model;         //   flush  ķ 
+    glm::vec3 color;
+    bool hasColor;           // objectColor 
+    glm::vec3 sortCenter;    //    ߽ (model ȯ)
+    const glm::mat4* bones;  //  ȷƮ (flush   ־ ),  nullptr
+    int boneCount;
+    std::function<void()> callback; // submitCallback: Ŷ   Լ ( DebugDraw::flush)
+    const char* profileScope;       // GPU Ϸ  ̸ (ͷ), nullptr =  
+
+    DrawPacket();
+};
+
+//   ť
+// 64Ʈ Ű = н(4) |  Ŷ(8, 1m) | α׷(12) | VAO(12) | ؽó(12) | Ŷ  (16)
+//  Ŷ  ա (early-z),  ڡ ׸,  Ŷ ȿ
+//  α׷/VAO/ؽó پ GL  ĳð  踦 Ѿ ߺ ε ɷ ݴϴ.
+//      ׸ϴ.
+// ݹ Ŷ н Ʈ ִ Ű ڱ н  տ ˴ϴ.
+// UI ť ġ ʰ flush ڿ   ٷ ׸ϴ.
+namespace RenderQueue {
+    //  ϳ  ( 꿡  view )
+    void begin(const glm::mat4& view);
+    void submit(const DrawPacket& packet);
+    void submitCallback(RenderPass pass, const std::function<void()>& callback, const char* profileScope = nullptr);
+    //    ϰ ť ϴ.
+    // ٱ  GpuProfiler   profileScope ٲ    ϴ
+    // (  Ŷ ȿ α׷ ̶ ⺰ Ŷ , Ŷ ٸ      ).
+    void flush();
+
+    uint64_t makeSortKey(RenderPass pass, GLuint program, GLuint vao, GLuint texture, float depth);
+
+    int getLastPacketCount(); //  flush  Ŷ 
+}
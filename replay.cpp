@@ -0,0 +1,302 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "replay.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+
+namespace Replay {
+
+    static const char REPLAY_MAGIC[4] = { 'R', 'P', 'L', 'Y' };
+    static const uint32_t REPLAY_VERSION = 3;   //  ̳ ùķ̼ Ģ ٲ ø (3:   ڽ)
+
+    //  Ӹ (ڿ eventBytes Ʈ Է ȭ, checksumCount uint32 üũ)
+    struct ReplayHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t seed;
+        uint32_t checkInterval;
+        uint64_t tickCount;       // ȭ  
+        uint32_t eventBytes;
+        uint32_t checksumCount;
+        float courseLength;       // World::startRun ѱ ڽ  (<= 0 ̸ )
+    };
+
+    // Է ȭ ϳ: tick mask  
+    struct InputEvent {
+        uint64_t tick;
+        uint8_t mask;
+    };
+
+    enum InputBit {
+        BIT_UP = 1 << 0,
+        BIT_DOWN = 1 << 1,
+        BIT_LEFT = 1 << 2,
+        BIT_RIGHT = 1 << 3,
+        BIT_JUMP = 1 << 4
+    };
+
+    enum Mode { IDLE, RECORDING, PLAYING };
+
+    static Mode g_mode = IDLE;
+    static std::string g_path;
+    static uint32_t g_seed = 0;
+    static float g_courseLength = 0.0f;
+    static uint32_t g_checkInterval = DEFAULT_CHECK_INTERVAL;
+    static uint64_t g_tick = 0;
+    static uint64_t g_tickCount = 0;                 // : ȭ  
+    static std::vector<InputEvent> g_events;
+    static std::vector<uint32_t> g_checksums;
+    static size_t g_nextEvent = 0;                   // :   ȭ
+    static uint8_t g_mask = 0;                       // ȭ:   / :   ִ Ű
+    static bool g_diverged = false;
+    static uint64_t g_divergedTick = 0;
+
+    static uint8_t packInput(const SimInput& input) {
+        return (uint8_t)((input.up ? BIT_UP : 0) | (input.down ? BIT_DOWN : 0)
+            | (input.left ? BIT_LEFT : 0) | (input.right ? BIT_RIGHT : 0) | (input.jump ? BIT_JUMP : 0));
+    }
+
+    static SimInput unpackInput(uint8_t mask) {
+        SimInput input;
+        input.up = (mask & BIT_UP) != 0;
+        input.down = (mask & BIT_DOWN) != 0;
+        input.left = (mask & BIT_LEFT) != 0;
+        input.right = (mask & BIT_RIGHT) != 0;
+        input.jump = (mask & BIT_JUMP) != 0;
+        return input;
+    }
+
+    // LEB128: 7Ʈ, ̾ ֻ Ʈ
+    static void writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+
+    static bool readVarint(const std::vector<uint8_t>& in, size_t& pos, uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+            uint8_t b = in[pos++];
+            value |= (uint64_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    static void clear() {
+        g_tick = 0;
+        g_tickCount = 0;
+        g_events.clear();
+        g_checksums.clear();
+        g_nextEvent = 0;
+        g_mask = 0;
+        g_diverged = false;
+        g_divergedTick = 0;
+    }
+
+    bool startRecording(const char* path, unsigned int seed, float courseLength, int checkInterval) {
+        clear();
+        g_path = path;
+        g_seed = seed;
+        g_courseLength = courseLength;
+        g_checkInterval = (uint32_t)(checkInterval > 0 ? checkInterval : DEFAULT_CHECK_INTERVAL);
+        g_mode = RECORDING;
+        std::cout << "[ȭ] õ " << g_seed << ", üũ " << g_checkInterval << "ܸ: " << g_path << std::endl;
+        return true;
+    }
+
+    bool startPlayback(const char* path) {
+        clear();
+        g_mode = IDLE;
+
+        FILE* f = fopen(path, "rb");
+        if (!f) {
+            std::cerr << "[]    ϴ: " << path << std::endl;
+            return false;
+        }
+        ReplayHeader header;
+        bool ok = fread(&header, sizeof(header), 1, f) == 1
+            && memcmp(header.magic, REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) == 0
+            && header.version == REPLAY_VERSION
+            && header.checkInterval > 0;
+        std::vector<uint8_t> payload;
+        if (ok) {
+            payload.resize(header.eventBytes);
+            g_checksums.resize(header.checksumCount);
+            ok = (payload.empty() || fread(payload.data(), payload.size(), 1, f) == 1)
+                && (g_checksums.empty() || fread(g_checksums.data(), g_checksums.size() * sizeof(uint32_t), 1, f) == 1);
+        }
+        fclose(f);
+
+        // Է ȭ Ǯ ( ȣ  ȭκ )
+        uint64_t tick = 0;
+        size_t pos = 0;
+        while (ok && pos < payload.size()) {
+            uint64_t delta = 0;
+            ok = readVarint(payload, pos, delta) && pos < payload.size();
+            if (!ok) break;
+            tick += delta;
+            InputEvent e = { tick, payload[pos++] };
+            g_events.push_back(e);
+        }
+        if (!ok) {
+            std::cerr << "[] ȭ  ƴϰų  ٸϴ: " << path << std::endl;
+            clear();
+            return false;
+        }
+
+        g_path = path;
+        g_seed = header.seed;
+        g_courseLength = header.courseLength;
+        g_checkInterval = header.checkInterval;
+        g_tickCount = header.tickCount;
+        g_mode = PLAYING;
+        std::cout << "[] õ " << g_seed << ", ڽ " << g_courseLength << "m, " << g_tickCount << ", Է ȭ " << g_events.size()
+            << ", üũ " << g_checksums.size() << ": " << g_path << std::endl;
+        return true;
+    }
+
+    bool isRecording() {
+        return g_mode == RECORDING;
+    }
+
+    bool isPlaying() {
+        return g_mode == PLAYING;
+    }
+
+    unsigned int getSeed() {
+        return g_seed;
+    }
+
+    float getCourseLength() {
+        return g_courseLength;
+    }
+
+    SimInput nextInput(const SimInput& live) {
+        if (g_mode == RECORDING) {
+            uint8_t mask = packInput(live);
+            if (mask != g_mask) {
+                InputEvent e = { g_tick, mask };
+                g_events.push_back(e);
+                g_mask = mask;
+            }
+            return live;
+        }
+        if (g_mode == PLAYING) {
+            while (g_nextEvent < g_events.size() && g_events[g_nextEvent].tick <= g_tick) {
+                g_mask = g_events[g_nextEvent].mask;
+                g_nextEvent++;
+            }
+            if (g_tick >= g_tickCount) return SimInput{};
+            return unpackInput(g_mask);
+        }
+        return live;
+    }
+
+    void endStep(unsigned int (*checksum)()) {
+        if (g_mode == IDLE) return;
+        g_tick++;
+        if (g_tick % g_checkInterval != 0) return;
+
+        if (g_mode == RECORDING) {
+            g_checksums.push_back(checksum());
+            return;
+        }
+
+        size_t index = (size_t)(g_tick / g_checkInterval) - 1;
+        if (g_diverged || index >= g_checksums.size()) return;
+        uint32_t actual = checksum();
+        if (actual != g_checksums[index]) {
+            g_diverged = true;
+            g_divergedTick = g_tick;
+            char line[128];
+            snprintf(line, sizeof(line), "[] %lluܿ  (üũ %08x, ȭ %08x)",
+                (unsigned long long)g_tick, actual, g_checksums[index]);
+            std::cerr << line << std::endl;
+        }
+    }
+
+    unsigned long long getTick() {
+        return g_tick;
+    }
+
+    bool isPlaybackDone() {
+        return g_mode == PLAYING && g_tick >= g_tickCount;
+    }
+
+    bool hasDiverged() {
+        return g_diverged;
+    }
+
+    unsigned long long getDivergedTick() {
+        return g_divergedTick;
+    }
+
+    // ȭ Է ȭ üũ Ϸ (ӽ Ͽ    ٲġ)
+    static bool save() {
+        std::vector<uint8_t> payload;
+        uint64_t prevTick = 0;
+        for (const InputEvent& e : g_events) {
+            writeVarint(payload, e.tick - prevTick);
+            payload.push_back(e.mask);
+            prevTick = e.tick;
+        }
+
+        ReplayHeader header;
+        memset(&header, 0, sizeof(header));   //  ä Ʈ 0 ( ̸  )
+        memcpy(header.magic, REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+        header.version = REPLAY_VERSION;
+        header.seed = g_seed;
+        header.checkInterval = g_checkInterval;
+        header.tickCount = g_tick;
+        header.eventBytes = (uint32_t)payload.size();
+        header.checksumCount = (uint32_t)g_checksums.size();
+        header.courseLength = g_courseLength;
+
+        std::string tempPath = g_path + ".tmp";
+        FILE* f = fopen(tempPath.c_str(), "wb");
+        if (!f) {
+            std::cerr << "[ȭ]    ϴ: " << g_path << std::endl;
+            return false;
+        }
+        bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+            && (payload.empty() || fwrite(payload.data(), payload.size(), 1, f) == 1)
+            && (g_checksums.empty() || fwrite(g_checksums.data(), g_checksums.size() * sizeof(uint32_t), 1, f) == 1);
+        ok = (fclose(f) == 0) && ok;
+        if (ok) {
+            remove(g_path.c_str());
+            ok = rename(tempPath.c_str(), g_path.c_str()) == 0;
+        }
+        if (!ok) {
+            remove(tempPath.c_str());
+            std::cerr << "[ȭ]    ϴ: " << g_path << std::endl;
+            return false;
+        }
+        std::cout << "[ȭ] " << g_tick << ", Է ȭ " << g_events.size() << ", üũ " << g_checksums.size()
+            << " (" << sizeof(header) + payload.size() + g_checksums.size() * sizeof(uint32_t) << "Ʈ) : " << g_path << std::endl;
+        return true;
+    }
+
+    bool finish() {
+        bool ok = true;
+        if (g_mode == RECORDING) {
+            ok = save();
+        }
+        else if (g_mode == PLAYING) {
+            ok = !g_diverged;
+            if (g_diverged) {
+                std::cout << "[] : " << g_divergedTick << "ܿ  (" << g_tick << "/" << g_tickCount << " )" << std::endl;
+            }
+            else {
+                std::cout << "[] : ġ (" << g_tick << "/" << g_tickCount << ", üũ "
+                    << (g_tick / g_checkInterval < g_checksums.size() ? g_tick / g_checkInterval : g_checksums.size()) << " )" << std::endl;
+            }
+        }
+        g_mode = IDLE;
+        return ok;
+    }
+}
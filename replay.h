@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include "world.h"
+
+// Է ȭ /  (GL , Ӱ 帮    )
+// World::step ѱ ܺ Է° ڽ(õ, )  ϳ ϰ, ϸ  Է  ܿ ٽ ֽϴ.
+// ӿ ȭ  帮 ص  üũ ; մϴ.
+//  õ +  Է̸ ùķ̼ Ʈ  ƾ ϹǷ checkInterval ܸ
+// World::checksum   ΰ,   ٸ ó   ˷ ݴϴ.
+//
+// : Ӹ + Է ٲ ܸ ( ȭκ   varint, Ű Ʈ 1Ʈ) + üũ 迭
+//  (800m,  2 )   Ʈ ~  KB
+namespace Replay {
+    static const int DEFAULT_CHECK_INTERVAL = 120;   // üũ  (, 1)
+
+    // ȭ  ( finish ). õ ڽ ̴ World::startRun ѱ  ״
+    bool startRecording(const char* path, unsigned int seed, float courseLength, int checkInterval);
+    //  о  غ. ϸ false (getSeed/getCourseLength ޾Ƽ World::startRun ѱ )
+    bool startPlayback(const char* path);
+
+    bool isRecording();
+    bool isPlaying();
+    unsigned int getSeed();
+    float getCourseLength();           // <= 0 ̸  ڽ
+
+    // ܸ World::step : ȭ ̸ live ϰ ״,  ̸ ϵ Է (   Է)
+    SimInput nextInput(const SimInput& live);
+    // ܸ World::step : üũ ̸ checksum() ҷ ϰų 
+    void endStep(unsigned int (*checksum)());
+
+    unsigned long long getTick();      // ݱ   
+    bool isPlaybackDone();             // ϵ   
+    bool hasDiverged();                //   üũ  ̶ ޶
+    unsigned long long getDivergedTick();
+
+    // ȭ:   / :  . Ŀ    (  ҷ )
+    bool finish();
+}
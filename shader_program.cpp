@@ -0,0 +1,347 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "shader_program.h"
+#include "gl_state.h"
+#include "program_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+
+// UniformSlot  ƾ 
+static const char* SLOT_NAMES[U_COUNT] = {
+    "model",
+    "normalMatrix",
+    "objectColor",
+    "wallTexture",
+    "bones",
+    "boneNormals",
+    "lightData",
+    "clusterGrid",
+    "lightIndices",
+    "lightmap",
+    "lightmapRect",
+};
+
+// ShaderVariantFlag Ʈ  ƾ 
+static const char* VARIANT_DEFINES[] = {
+    "#define TEXTURED\n",
+    "#define LIT\n",
+    "#define INSTANCED\n",
+    "#define SKINNED\n",
+    "#define INSTANCE_COLOR\n",
+    "#define LIGHTMAPPED\n",
+};
+
+// "#version ..."  ٷ ڿ defines   ҽ (#version ׻  ̾ )
+static std::string injectDefines(const char* source, const char* defines)
+{
+    std::string text(source);
+    if (!defines || !*defines) return text;
+    size_t insertAt = 0;
+    if (text.compare(0, 8, "#version") == 0) {
+        size_t eol = text.find('\n');
+        insertAt = (eol == std::string::npos) ? text.size() : eol + 1;
+    }
+    text.insert(insertAt, defines);
+    return text;
+}
+
+static char* filetobuf(const char* file)
+{
+    FILE* fptr;
+    long length;
+    char* buf;
+    fptr = fopen(file, "rb");
+    if (!fptr)
+        return NULL;
+    fseek(fptr, 0, SEEK_END);
+    length = ftell(fptr);
+    buf = (char*)malloc(length + 1);
+    fseek(fptr, 0, SEEK_SET);
+    fread(buf, length, 1, fptr);
+    fclose(fptr);
+    buf[length] = 0;
+    return buf;
+}
+
+static GLuint compileShader(GLenum type, const char* source, const char* path)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint result;
+    GLchar errorLog[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
+    if (!result)
+    {
+        glGetShaderInfoLog(shader, 512, NULL, errorLog);
+        std::cerr << "ERROR: " << path << "  \n" << errorLog << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+ShaderProgram::ShaderProgram() : m_id(0) {
+    for (int i = 0; i < U_COUNT; ++i) {
+        m_slots[i] = -1;
+        m_valueValid[i] = false;
+    }
+}
+
+bool ShaderProgram::build(const char* vertexPath, const char* fragmentPath, const char* defines)
+{
+    GLchar* vertexFile = filetobuf(vertexPath);
+    GLchar* fragmentFile = filetobuf(fragmentPath);
+    if (!vertexFile || !fragmentFile) {
+        std::cerr << "ERROR: ̴    " << (vertexFile ? fragmentPath : vertexPath) << std::endl;
+        free(vertexFile);
+        free(fragmentFile);
+        return false;
+    }
+    std::string vertexText = injectDefines(vertexFile, defines);
+    std::string fragmentText = injectDefines(fragmentFile, defines);
+    free(vertexFile);
+    free(fragmentFile);
+    const char* vertexSource = vertexText.c_str();
+    const char* fragmentSource = fragmentText.c_str();
+
+    //  ҽ +  ̹ ũ   ũ  ٷ 
+    const char* sources[2] = { vertexSource, fragmentSource };
+    uint64_t cacheKey = ProgramCache::makeKey(sources, 2);
+    m_id = glCreateProgram();
+    bool linked = ProgramCache::load(m_id, cacheKey);
+    if (!linked) {
+        linked = compileAndLink(vertexSource, vertexPath, fragmentSource, fragmentPath);
+        if (linked) ProgramCache::store(m_id, cacheKey);
+    }
+
+    if (!linked) {
+        glDeleteProgram(m_id);
+        m_id = 0;
+        return false;
+    }
+
+    cacheUniforms();
+    GLState::useProgram(m_id);
+    // ÷  α׷ ̶ ũ   
+    setInt(U_LIGHT_DATA, LIGHT_DATA_UNIT);
+    setInt(U_CLUSTER_GRID, CLUSTER_GRID_UNIT);
+    setInt(U_LIGHT_INDICES, LIGHT_INDEX_UNIT);
+    setInt(U_LIGHTMAP, LIGHTMAP_UNIT);
+    return true;
+}
+
+// ĳð  : ҽ  + ũ (m_id   )
+bool ShaderProgram::compileAndLink(const char* vertexSource, const char* vertexPath,
+                                   const char* fragmentSource, const char* fragmentPath)
+{
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource, vertexPath);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource, fragmentPath);
+    if (!vertexShader || !fragmentShader) {
+        if (vertexShader) glDeleteShader(vertexShader);
+        if (fragmentShader) glDeleteShader(fragmentShader);
+        return false;
+    }
+
+    GLint result;
+    GLchar errorLog[512];
+    ProgramCache::prepareForLink(m_id);
+    glAttachShader(m_id, vertexShader);
+    glAttachShader(m_id, fragmentShader);
+    glLinkProgram(m_id);
+    glDetachShader(m_id, vertexShader);
+    glDetachShader(m_id, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glGetProgramiv(m_id, GL_LINK_STATUS, &result);
+    if (!result) {
+        glGetProgramInfoLog(m_id, 512, NULL, errorLog);
+        std::cerr << "ERROR: shader program  \n" << errorLog << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ũ   : Ȱ uniform ü ȸ + ī޶  ε
+void ShaderProgram::cacheUniforms()
+{
+    m_uniforms.clear();
+
+    GLint count = 0;
+    glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        GLchar name[128];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_id, (GLuint)i, sizeof(name), &length, &size, &type, name);
+
+        GLint loc = glGetUniformLocation(m_id, name);
+        if (loc < 0) continue; // uniform    ġ 
+
+        // 迭 "bones[0]" · Ƿ "bones"ε ã  ְ
+        std::string key(name, length);
+        size_t bracket = key.find('[');
+        if (bracket != std::string::npos) key = key.substr(0, bracket);
+        m_uniforms[key] = loc;
+    }
+
+    for (int i = 0; i < U_COUNT; ++i) {
+        m_slots[i] = location(SLOT_NAMES[i]);
+        m_valueValid[i] = false;
+    }
+
+    GLuint blockIndex = glGetUniformBlockIndex(m_id, "Camera");
+    if (blockIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(m_id, blockIndex, CAMERA_BLOCK_BINDING);
+}
+
+GLint ShaderProgram::location(const char* name) const
+{
+    auto it = m_uniforms.find(name);
+    return (it != m_uniforms.end()) ? it->second : -1;
+}
+
+void ShaderProgram::destroy()
+{
+    if (m_id) {
+        GLState::forgetProgram(m_id);
+        glDeleteProgram(m_id);
+    }
+    m_id = 0;
+    m_uniforms.clear();
+    for (int i = 0; i < U_COUNT; ++i) {
+        m_slots[i] = -1;
+        m_valueValid[i] = false;
+    }
+}
+
+void ShaderProgram::use() const
+{
+    GLState::useProgram(m_id);
+}
+
+bool ShaderProgram::updateCache(UniformSlot slot, const void* data, size_t bytes) const
+{
+    if (m_valueValid[slot] && memcmp(m_values[slot], data, bytes) == 0) {
+        GLState::countUniform(true);
+        return false;
+    }
+    memcpy(m_values[slot], data, bytes);
+    m_valueValid[slot] = true;
+    GLState::countUniform(false);
+    return true;
+}
+
+// setter  α׷ ε ¿ ҷ մϴ (use() )
+void ShaderProgram::setInt(UniformSlot slot, int value) const
+{
+    if (m_slots[slot] < 0) return;
+    if (updateCache(slot, &value, sizeof(value))) glUniform1i(m_slots[slot], value);
+}
+
+void ShaderProgram::setVec3(UniformSlot slot, const glm::vec3& value) const
+{
+    if (m_slots[slot] < 0) return;
+    if (updateCache(slot, glm::value_ptr(value), 3 * sizeof(float))) glUniform3fv(m_slots[slot], 1, glm::value_ptr(value));
+}
+
+void ShaderProgram::setVec4(UniformSlot slot, const glm::vec4& value) const
+{
+    if (m_slots[slot] < 0) return;
+    if (updateCache(slot, glm::value_ptr(value), 4 * sizeof(float))) glUniform4fv(m_slots[slot], 1, glm::value_ptr(value));
+}
+
+void ShaderProgram::setMat3(UniformSlot slot, const glm::mat3& value) const
+{
+    if (m_slots[slot] < 0) return;
+    if (updateCache(slot, glm::value_ptr(value), 9 * sizeof(float))) glUniformMatrix3fv(m_slots[slot], 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void ShaderProgram::setMat4(UniformSlot slot, const glm::mat4& value) const
+{
+    if (m_slots[slot] < 0) return;
+    if (updateCache(slot, glm::value_ptr(value), 16 * sizeof(float))) glUniformMatrix4fv(m_slots[slot], 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void ShaderProgram::setMat4Array(UniformSlot slot, const glm::mat4* values, int count) const
+{
+    if (m_slots[slot] < 0 || count <= 0) return;
+    GLState::countUniform(false);
+    glUniformMatrix4fv(m_slots[slot], count, GL_FALSE, glm::value_ptr(values[0]));
+}
+
+void ShaderProgram::setMat3Array(UniformSlot slot, const glm::mat3* values, int count) const
+{
+    if (m_slots[slot] < 0 || count <= 0) return;
+    GLState::countUniform(false);
+    glUniformMatrix3fv(m_slots[slot], count, GL_FALSE, glm::value_ptr(values[0]));
+}
+
+// --- ̴  ---
+void ShaderVariants::init(const char* vertexPath, const char* fragmentPath)
+{
+    m_vertexPath = vertexPath;
+    m_fragmentPath = fragmentPath;
+}
+
+const ShaderProgram* ShaderVariants::get(unsigned int flags)
+{
+    if (flags >= VARIANT_COUNT || m_failed[flags]) return nullptr;
+    if (!m_built[flags]) {
+        std::string defines;
+        for (int bit = 0; (1u << bit) < (unsigned int)VARIANT_COUNT; ++bit) {
+            if (flags & (1u << bit)) defines += VARIANT_DEFINES[bit];
+        }
+        if (!m_programs[flags].build(m_vertexPath.c_str(), m_fragmentPath.c_str(), defines.c_str())) {
+            std::cerr << "ERROR: ̴  " << flags << "  " << std::endl;
+            m_failed[flags] = true;
+            return nullptr;
+        }
+        m_built[flags] = true;
+    }
+    return &m_programs[flags];
+}
+
+void ShaderVariants::destroy()
+{
+    for (int i = 0; i < VARIANT_COUNT; ++i) {
+        if (m_built[i]) m_programs[i].destroy();
+        m_built[i] = false;
+        m_failed[i] = false;
+    }
+}
+
+// --- ī޶ UBO ---
+namespace CameraUBO {
+
+    static GLuint g_ubo = 0;
+
+    bool init() {
+        glGenBuffers(1, &g_ubo);
+        glBindBuffer(GL_UNIFORM_BUFFER, g_ubo);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(CameraBlock), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        // ε Ʈ    θ  α׷  
+        glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BLOCK_BINDING, g_ubo);
+        return g_ubo != 0;
+    }
+
+    void update(const CameraBlock& block) {
+        glBindBuffer(GL_UNIFORM_BUFFER, g_ubo);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(CameraBlock), &block);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    void cleanup() {
+        if (g_ubo) glDeleteBuffers(1, &g_ubo);
+        g_ubo = 0;
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+//   uniform  (ũ  ġ   ã Ӵϴ)
+// (  uniform ġ -1̶ setter ׳ ǳʶ)
+enum UniformSlot {
+    U_MODEL,
+    U_NORMAL_MATRIX,
+    U_OBJECT_COLOR,
+    U_WALL_TEXTURE,
+    U_BONES,
+    U_BONE_NORMALS,
+    U_LIGHT_DATA,      // Ŭ  ؽó  (LightGrid)
+    U_CLUSTER_GRID,
+    U_LIGHT_INDICES,
+    U_LIGHTMAP,        //   Ʋ (VARIANT_LIGHTMAPPED)
+    U_LIGHTMAP_RECT,   // Ʋ   Ŷ 
+    U_COUNT
+};
+
+// ̴  ÷ (#define   )
+enum ShaderVariantFlag {
+    VARIANT_TEXTURED = 1 << 0,        // wallTexture  (ƴϸ objectColor)
+    VARIANT_LIT = 1 << 1,             // ֺ + ݻ + ݻ籤 (ƴϸ  ״)
+    VARIANT_INSTANCED = 1 << 2,       // 3~6 νϽ , 9~11 νϽ  
+    VARIANT_SKINNED = 1 << 3,         // 8  ȣ bones[] / boneNormals[] 
+    VARIANT_INSTANCE_COLOR = 1 << 4,  // 7 νϽ  (objectColor )
+    VARIANT_LIGHTMAPPED = 1 << 5,     //     (LIT ,  ʴ ͳ )
+    VARIANT_COUNT = 1 << 6
+};
+
+// ̴ bones[] 迭 ũ (acting3_vertex.glsl ƾ )
+static const int MAX_BONES = 6;
+
+// ī޶ uniform  ε ȣ ( α׷  ȣ )
+static const GLuint CAMERA_BLOCK_BINDING = 0;
+
+// Ŭ  ؽó   (0 wallTexture  Ϲ ؽó)
+// ũ  ÷    ΰ, LightGrid::init  ֿ ε Ӵϴ.
+static const int LIGHT_DATA_UNIT = 1;
+static const int CLUSTER_GRID_UNIT = 2;
+static const int LIGHT_INDEX_UNIT = 3;
+//   Ʋ  (Ŷ RenderQueue ε)
+static const int LIGHTMAP_UNIT = 4;
+
+// ̴ α׷ 
+// /ũ  Ȱ uniform  ȸؼ ̸  ġ ǥ  ΰ,
+// ׸ ڵ忡 glGetUniformLocation  ĳõ ġ մϴ.
+// Ժ    ؼ  ̸ glUniform* մϴ.
+// (uniform  α׷  ǹǷ α׷  ĳ)
+// ũ  ProgramCache ũ ؼ  ʹ  ǳʶݴϴ.
+class ShaderProgram {
+public:
+    ShaderProgram();
+
+    // defines: #version  ٷ ڿ   "#define ..." ٵ ( nullptr)
+    bool build(const char* vertexPath, const char* fragmentPath, const char* defines = nullptr);
+    void destroy();
+
+    void use() const;
+    GLuint id() const { return m_id; }
+
+    GLint location(UniformSlot slot) const { return m_slots[slot]; }
+    GLint location(const char* name) const; // ũ   ǥ ã ( -1)
+
+    void setInt(UniformSlot slot, int value) const;
+    void setVec3(UniformSlot slot, const glm::vec3& value) const;
+    void setVec4(UniformSlot slot, const glm::vec4& value) const;
+    void setMat3(UniformSlot slot, const glm::mat3& value) const;
+    void setMat4(UniformSlot slot, const glm::mat4& value) const;
+    //  迭 ( ȷƮ ):   glUniformMatrix*fv ø,  ĳô  
+    void setMat3Array(UniformSlot slot, const glm::mat3* values, int count) const;
+    void setMat4Array(UniformSlot slot, const glm::mat4* values, int count) const;
+
+private:
+    bool compileAndLink(const char* vertexSource, const char* vertexPath,
+                        const char* fragmentSource, const char* fragmentPath);
+    void cacheUniforms();
+    //  ٲ ĳø ϰ true (GLState   )
+    bool updateCache(UniformSlot slot, const void* data, size_t bytes) const;
+
+    GLuint m_id;
+    GLint m_slots[U_COUNT];
+    mutable float m_values[U_COUNT][16]; // Ժ   (mat4)
+    mutable bool m_valueValid[U_COUNT];
+    std::unordered_map<std::string, GLint> m_uniforms;
+};
+
+//  ҽ  ֿ   
+//  ó get    ϰ (̳ʸ ProgramCache ), Ŀ ״ ݴϴ.
+//  ʱȭ  ʿ  ޾ ΰ Ŷ  α׷ ֽϴ.
+class ShaderVariants {
+public:
+    void init(const char* vertexPath, const char* fragmentPath);
+    const ShaderProgram* get(unsigned int flags); //  и nullptr
+    void destroy();
+
+private:
+    std::string m_vertexPath;
+    std::string m_fragmentPath;
+    ShaderProgram m_programs[VARIANT_COUNT];
+    bool m_built[VARIANT_COUNT] = {};
+    bool m_failed[VARIANT_COUNT] = {};
+};
+
+// /  ī޶ +   (std140 uniform  "Camera")
+// vec3 std140 16Ʈ ĵǹǷ vec4 ä Ӵϴ.
+struct CameraBlock {
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 viewPos;
+    glm::vec4 lightPos;
+    glm::vec4 lightColor;
+    glm::vec4 clusterScale; // Ÿ ȼ ũ w, h /   = log() * z + w
+    glm::vec4 clusterInfo;  // x: Ŭ  (1/0), y/z/w: Ÿ x, Ÿ y,   
+};
+
+namespace CameraUBO {
+    bool init();
+    //  ϳ  :  ü glBufferSubData   
+    void update(const CameraBlock& block);
+    void cleanup();
+}
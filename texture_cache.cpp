@@ -0,0 +1,485 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "texture_cache.h"
+#include "gl_state.h"
+#include "cpu_profiler.h"
+#include "stb_image.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace TextureCache {
+
+    static const char COOKED_MAGIC[4] = { 'C', 'T', 'E', 'X' };
+    static const uint32_t COOKED_VERSION = 1;
+    static const int MAX_MIPS = MAX_MIP_LEVELS; // 32768 x 32768 
+
+    struct MipEntry {
+        uint32_t offset;   //  ó Ʈ ġ
+        uint32_t size;
+    };
+
+    // .ctex  Ӹ (Ʋ , ڿ  Ͱ ū ͺ ̾)
+    struct CookedHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t format;        // Format
+        uint32_t width;
+        uint32_t height;
+        uint32_t mipCount;
+        uint64_t sourceSize;    // ŷ   ũ/ ð (ٲ ٽ ŷ)
+        uint64_t sourceTime;
+        MipEntry mips[MAX_MIPS];
+    };
+
+    // init  尡    (۾  б⸸)
+    static bool g_s3tcSupported = false;
+    static bool g_compression = false;
+
+    void init() {
+        g_s3tcSupported = GLEW_EXT_texture_compression_s3tc != 0;
+        g_compression = g_s3tcSupported;
+        stbi_set_flip_vertically_on_load(true); // OpenGL ǥ迡    (stb  ̶ ⼭  )
+    }
+
+    void setCompressionEnabled(bool enabled) {
+        g_compression = enabled && g_s3tcSupported;
+    }
+
+    // ---------------------------------------------------------------
+    // б  ޸ 
+    // ---------------------------------------------------------------
+    struct MappedFile {
+        const unsigned char* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = NULL;
+#endif
+    };
+
+    static bool mapFile(const char* path, MappedFile& out) {
+#ifdef _WIN32
+        out.file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (out.file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(out.file, &size) || size.QuadPart == 0) {
+            CloseHandle(out.file);
+            out.file = INVALID_HANDLE_VALUE;
+            return false;
+        }
+        out.mapping = CreateFileMappingA(out.file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (out.mapping == NULL) {
+            CloseHandle(out.file);
+            out.file = INVALID_HANDLE_VALUE;
+            return false;
+        }
+        out.data = (const unsigned char*)MapViewOfFile(out.mapping, FILE_MAP_READ, 0, 0, 0);
+        if (out.data == nullptr) {
+            CloseHandle(out.mapping);
+            CloseHandle(out.file);
+            out.mapping = NULL;
+            out.file = INVALID_HANDLE_VALUE;
+            return false;
+        }
+        out.size = (size_t)size.QuadPart;
+        return true;
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); //  fd ݾƵ 
+        if (p == MAP_FAILED) return false;
+        out.data = (const unsigned char*)p;
+        out.size = (size_t)st.st_size;
+        return true;
+#endif
+    }
+
+    static void unmapFile(MappedFile& f) {
+#ifdef _WIN32
+        if (f.data) UnmapViewOfFile(f.data);
+        if (f.mapping) CloseHandle(f.mapping);
+        if (f.file != INVALID_HANDLE_VALUE) CloseHandle(f.file);
+        f.mapping = NULL;
+        f.file = INVALID_HANDLE_VALUE;
+#else
+        if (f.data) munmap((void*)f.data, f.size);
+#endif
+        f.data = nullptr;
+        f.size = 0;
+    }
+
+    //   ũ/ ð.  false
+    static bool sourceStamp(const char* path, uint64_t& size, uint64_t& time) {
+        struct stat st;
+        if (stat(path, &st) != 0) return false;
+        size = (uint64_t)st.st_size;
+        time = (uint64_t)st.st_mtime;
+        return true;
+    }
+
+    // ---------------------------------------------------------------
+    // Ӹ /  
+    // ---------------------------------------------------------------
+    struct Image {
+        int width = 0, height = 0, channels = 0;
+        std::vector<unsigned char> pixels;
+    };
+
+    // 2x2 ڽ ͷ  ũ ̹ (Ȧ ũ ڸ ȼ    )
+    static Image downsample(const Image& src) {
+        Image dst;
+        dst.width = (src.width > 1) ? src.width / 2 : 1;
+        dst.height = (src.height > 1) ? src.height / 2 : 1;
+        dst.channels = src.channels;
+        dst.pixels.resize((size_t)dst.width * dst.height * dst.channels);
+
+        for (int y = 0; y < dst.height; ++y) {
+            int y0 = (y * 2 < src.height) ? y * 2 : src.height - 1;
+            int y1 = (y * 2 + 1 < src.height) ? y * 2 + 1 : y0;
+            for (int x = 0; x < dst.width; ++x) {
+                int x0 = (x * 2 < src.width) ? x * 2 : src.width - 1;
+                int x1 = (x * 2 + 1 < src.width) ? x * 2 + 1 : x0;
+                for (int c = 0; c < src.channels; ++c) {
+                    int sum = src.pixels[((size_t)y0 * src.width + x0) * src.channels + c]
+                            + src.pixels[((size_t)y0 * src.width + x1) * src.channels + c]
+                            + src.pixels[((size_t)y1 * src.width + x0) * src.channels + c]
+                            + src.pixels[((size_t)y1 * src.width + x1) * src.channels + c];
+                    dst.pixels[((size_t)y * dst.width + x) * dst.channels + c] = (unsigned char)((sum + 2) / 4);
+                }
+            }
+        }
+        return dst;
+    }
+
+    static uint16_t packRGB565(const unsigned char* rgb) {
+        return (uint16_t)(((rgb[0] * 31 + 127) / 255) << 11 | ((rgb[1] * 63 + 127) / 255) << 5 | ((rgb[2] * 31 + 127) / 255));
+    }
+
+    static void unpackRGB565(uint16_t c, int* rgb) {
+        int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    // 4x4 (RGBA 16ȼ)  κ -> BC1 8Ʈ
+    //   ٿ ڽ (¦ ), ׻ 4  (c0 > c1)
+    static void encodeColorBlock(const unsigned char block[16][4], unsigned char* out) {
+        unsigned char lo[3] = { 255, 255, 255 }, hi[3] = { 0, 0, 0 };
+        for (int i = 0; i < 16; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                if (block[i][c] < lo[c]) lo[c] = block[i][c];
+                if (block[i][c] > hi[c]) hi[c] = block[i][c];
+            }
+        }
+        for (int c = 0; c < 3; ++c) {
+            int inset = (hi[c] - lo[c]) / 16;
+            lo[c] = (unsigned char)(lo[c] + inset);
+            hi[c] = (unsigned char)(hi[c] - inset);
+        }
+
+        uint16_t c0 = packRGB565(hi), c1 = packRGB565(lo);
+        if (c0 < c1) { uint16_t t = c0; c0 = c1; c1 = t; }
+
+        uint32_t indices = 0;
+        if (c0 != c1) {
+            int palette[4][3];
+            unpackRGB565(c0, palette[0]);
+            unpackRGB565(c1, palette[1]);
+            for (int c = 0; c < 3; ++c) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+            for (int i = 0; i < 16; ++i) {
+                int best = 0, bestDist = 0x7FFFFFFF;
+                for (int p = 0; p < 4; ++p) {
+                    int dr = block[i][0] - palette[p][0], dg = block[i][1] - palette[p][1], db = block[i][2] - palette[p][2];
+                    int d = dr * dr + dg * dg + db * db;
+                    if (d < bestDist) { bestDist = d; best = p; }
+                }
+                indices |= (uint32_t)best << (i * 2);
+            }
+        }
+        // c0 == c1 ̸ ε  0 (ܻ )
+
+        out[0] = (unsigned char)(c0 & 0xFF); out[1] = (unsigned char)(c0 >> 8);
+        out[2] = (unsigned char)(c1 & 0xFF); out[3] = (unsigned char)(c1 >> 8);
+        for (int i = 0; i < 4; ++i) out[4 + i] = (unsigned char)(indices >> (i * 8));
+    }
+
+    // 4x4   -> BC3  8Ʈ (8ܰ , a0 > a1)
+    static void encodeAlphaBlock(const unsigned char block[16][4], unsigned char* out) {
+        int lo = 255, hi = 0;
+        for (int i = 0; i < 16; ++i) {
+            if (block[i][3] < lo) lo = block[i][3];
+            if (block[i][3] > hi) hi = block[i][3];
+        }
+        out[0] = (unsigned char)hi;
+        out[1] = (unsigned char)lo;
+
+        uint64_t indices = 0;
+        if (hi != lo) {
+            int palette[8];
+            palette[0] = hi;
+            palette[1] = lo;
+            for (int p = 1; p < 7; ++p) palette[p + 1] = ((7 - p) * hi + p * lo) / 7;
+            for (int i = 0; i < 16; ++i) {
+                int best = 0, bestDist = 256;
+                for (int p = 0; p < 8; ++p) {
+                    int d = block[i][3] - palette[p];
+                    if (d < 0) d = -d;
+                    if (d < bestDist) { bestDist = d; best = p; }
+                }
+                indices |= (uint64_t)best << (i * 3);
+            }
+        }
+        for (int i = 0; i < 6; ++i) out[2 + i] = (unsigned char)(indices >> (i * 8));
+    }
+
+    static size_t levelSize(Format format, int w, int h) {
+        size_t bw = (size_t)((w + 3) / 4), bh = (size_t)((h + 3) / 4);
+        switch (format) {
+        case FORMAT_BC1: return bw * bh * 8;
+        case FORMAT_BC3: return bw * bh * 16;
+        case FORMAT_RGBA8: return (size_t)w * h * 4;
+        default: return (size_t)w * h * 3;
+        }
+    }
+
+    //    format ڵؼ out ڿ 
+    static void encodeLevel(const Image& img, Format format, std::vector<unsigned char>& out) {
+        if (format == FORMAT_RGB8 || format == FORMAT_RGBA8) {
+            out.insert(out.end(), img.pixels.begin(), img.pixels.end());
+            return;
+        }
+
+        size_t base = out.size();
+        out.resize(base + levelSize(format, img.width, img.height));
+        unsigned char* dst = &out[base];
+
+        unsigned char block[16][4];
+        for (int by = 0; by < img.height; by += 4) {
+            for (int bx = 0; bx < img.width; bx += 4) {
+                // ڸ   ȼ ݺؼ ä
+                for (int i = 0; i < 16; ++i) {
+                    int x = bx + (i & 3), y = by + (i >> 2);
+                    if (x >= img.width) x = img.width - 1;
+                    if (y >= img.height) y = img.height - 1;
+                    const unsigned char* p = &img.pixels[((size_t)y * img.width + x) * img.channels];
+                    block[i][0] = p[0];
+                    block[i][1] = p[1];
+                    block[i][2] = p[2];
+                    block[i][3] = (img.channels == 4) ? p[3] : 255;
+                }
+                if (format == FORMAT_BC3) {
+                    encodeAlphaBlock(block, dst);
+                    dst += 8;
+                }
+                encodeColorBlock(block, dst);
+                dst += 8;
+            }
+        }
+    }
+
+    bool cook(const char* filename, const char* cookedPath) {
+        PROFILE_ZONE("TextureCache::cook");
+        uint64_t srcSize = 0, srcTime = 0;
+        if (!sourceStamp(filename, srcSize, srcTime)) return false;
+
+        Image level;
+        unsigned char* data = stbi_load(filename, &level.width, &level.height, &level.channels, 0);
+        if (!data) return false;
+
+        // ȸ  RGB ٽ 
+        if (level.channels != 3 && level.channels != 4) {
+            stbi_image_free(data);
+            data = stbi_load(filename, &level.width, &level.height, &level.channels, 3);
+            if (!data) return false;
+            level.channels = 3;
+        }
+        level.pixels.assign(data, data + (size_t)level.width * level.height * level.channels);
+        stbi_image_free(data);
+
+        Format format;
+        if (g_compression) format = (level.channels == 4) ? FORMAT_BC3 : FORMAT_BC1;
+        else format = (level.channels == 4) ? FORMAT_RGBA8 : FORMAT_RGB8;
+
+        CookedHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, COOKED_MAGIC, sizeof(COOKED_MAGIC));
+        header.version = COOKED_VERSION;
+        header.format = (uint32_t)format;
+        header.width = (uint32_t)level.width;
+        header.height = (uint32_t)level.height;
+        header.sourceSize = srcSize;
+        header.sourceTime = srcTime;
+
+        std::vector<unsigned char> payload;
+        for (int mip = 0; mip < MAX_MIPS; ++mip) {
+            size_t before = payload.size();
+            encodeLevel(level, format, payload);
+            header.mips[mip].offset = (uint32_t)(sizeof(CookedHeader) + before);
+            header.mips[mip].size = (uint32_t)(payload.size() - before);
+            header.mipCount = (uint32_t)(mip + 1);
+            if (level.width == 1 && level.height == 1) break;
+            level = downsample(level);
+        }
+
+        // ӽ Ͽ    ٲġ (߰ ܵ  ĳð  ʰ)
+        std::string tempPath = std::string(cookedPath) + ".tmp";
+        FILE* f = fopen(tempPath.c_str(), "wb");
+        if (!f) return false;
+        bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+            && (payload.empty() || fwrite(payload.data(), payload.size(), 1, f) == 1);
+        ok = (fclose(f) == 0) && ok;
+        if (ok) {
+            remove(cookedPath);
+            ok = rename(tempPath.c_str(), cookedPath) == 0;
+        }
+        if (!ok) remove(tempPath.c_str());
+        return ok;
+    }
+
+    // ε .ctex Ӹ   (   )
+    static bool validate(const MappedFile& file, const char* filename) {
+        if (file.size < sizeof(CookedHeader)) return false;
+        const CookedHeader* h = (const CookedHeader*)file.data;
+        if (memcmp(h->magic, COOKED_MAGIC, sizeof(COOKED_MAGIC)) != 0) return false;
+        if (h->version != COOKED_VERSION) return false;
+        if (h->format > FORMAT_BC3 || h->width == 0 || h->height == 0) return false;
+        if (h->mipCount == 0 || h->mipCount > (uint32_t)MAX_MIPS) return false;
+        for (uint32_t i = 0; i < h->mipCount; ++i) {
+            if ((uint64_t)h->mips[i].offset + h->mips[i].size > file.size) return false;
+        }
+
+        //  ε  GPU    ٽ ŷ
+        bool compressed = (h->format == FORMAT_BC1 || h->format == FORMAT_BC3);
+        if (compressed && !g_s3tcSupported) return false;
+
+        uint64_t srcSize, srcTime;
+        if (sourceStamp(filename, srcSize, srcTime)) {
+            if (srcSize != h->sourceSize || srcTime != h->sourceTime) return false;
+        }
+        return true;
+    }
+
+    bool prepare(const char* filename, CookedTexture& out) {
+        PROFILE_ZONE("TextureCache::prepare");
+        std::string cookedPath = std::string(filename) + ".ctex";
+
+        MappedFile* file = new MappedFile();
+        bool mapped = mapFile(cookedPath.c_str(), *file);
+        if (mapped && !validate(*file, filename)) {
+            unmapFile(*file);
+            mapped = false;
+        }
+        if (!mapped) {
+            // cache miss:  ŷ  ٽ 
+            if (!cook(filename, cookedPath.c_str()) || !mapFile(cookedPath.c_str(), *file)) {
+                std::cout << "ؽó ε : " << filename << std::endl;
+                delete file;
+                return false;
+            }
+            if (!validate(*file, filename)) {
+                unmapFile(*file);
+                delete file;
+                std::cout << "ؽó ε  (ŷ  ̻): " << filename << std::endl;
+                return false;
+            }
+            std::cout << "ؽó ŷ: " << filename << " -> " << cookedPath << std::endl;
+        }
+
+        const CookedHeader* h = (const CookedHeader*)file->data;
+        out.format = (Format)h->format;
+        out.width = (int)h->width;
+        out.height = (int)h->height;
+        out.mipCount = (int)h->mipCount;
+        for (int mip = 0; mip < out.mipCount; ++mip) {
+            out.levels[mip] = file->data + h->mips[mip].offset;
+            out.levelSizes[mip] = h->mips[mip].size;
+        }
+        out.handle = file;
+        return true;
+    }
+
+    void release(CookedTexture& tex) {
+        MappedFile* file = (MappedFile*)tex.handle;
+        if (file) {
+            unmapFile(*file);
+            delete file;
+        }
+        tex.handle = nullptr;
+        tex.mipCount = 0;
+    }
+
+    GLuint createTexture(const CookedTexture& tex) {
+        GLuint textureID;
+        glGenTextures(1, &textureID);
+        GLState::bindTexture(GL_TEXTURE_2D, textureID);
+
+        // ؽó ݺ  ͸  (Ӹ ü Ƿ Ҵ Ʈ̸Ͼ)
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, tex.mipCount - 1);
+        return textureID;
+    }
+
+    void uploadLevel(const CookedTexture& tex, int level, const void* data) {
+        int w = tex.width >> level, h = tex.height >> level;
+        if (w < 1) w = 1;
+        if (h < 1) h = 1;
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // RGB    4Ʈ  ƴ
+        switch (tex.format) {
+        case FORMAT_BC1:
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, w, h, 0, tex.levelSizes[level], data);
+            break;
+        case FORMAT_BC3:
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, w, h, 0, tex.levelSizes[level], data);
+            break;
+        case FORMAT_RGBA8:
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            break;
+        default:
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGB8, w, h, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+            break;
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    GLuint load(const char* filename) {
+        CookedTexture tex;
+        if (!prepare(filename, tex)) return 0;
+
+        GLuint textureID = createTexture(tex);
+        for (int mip = 0; mip < tex.mipCount; ++mip) uploadLevel(tex, mip, tex.levels[mip]);
+        std::cout << "ؽó ε : " << filename << " (" << tex.width << "x" << tex.height
+                  << ",  " << tex.mipCount << "ܰ,  " << tex.format << ")" << std::endl;
+
+        release(tex);
+        return textureID;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <GL/glew.h>
+
+// ŷ ؽó ĳ
+//  ̹(jpg/png)  "<>.ctex"   ΰ  ʹ װ͸ нϴ.
+//  - ̸ ٿ  Ӹ ü (ڽ ) -> glGenerateMipmap 
+//  - S3TC ϸ BC1(RGB) / BC3(RGBA)  , ƴϸ  RGB/RGBA
+//  -  ޸ ؼ   ״ glCompressedTexImage2D / glTexImage2D ѱ
+//  ũ/ ð ٲų ĳð  (cache miss) ڵ ٽ ŷմϴ.
+//   .ctex ־ ε˴ϴ ().
+namespace TextureCache {
+    enum Format {
+        FORMAT_RGB8 = 0,
+        FORMAT_RGBA8 = 1,
+        FORMAT_BC1 = 2,   // DXT1, 4x4 ϴ 8Ʈ ( )
+        FORMAT_BC3 = 3,   // DXT5, 4x4 ϴ 16Ʈ
+    };
+
+    static const int MAX_MIP_LEVELS = 16;
+
+    // ε .ctex   (prepare ~ release ̿ levels Ͱ ȿ)
+    struct CookedTexture {
+        Format format = FORMAT_RGB8;
+        int width = 0, height = 0;
+        int mipCount = 0;
+        const unsigned char* levels[MAX_MIP_LEVELS] = {};
+        unsigned int levelSizes[MAX_MIP_LEVELS] = {};
+        void* handle = nullptr;   //   
+    };
+
+    //  , GL ؽƮ   ۾ 庸  (AssetLoader::init θ)
+    // S3TC  θ   о ιǷ  prepare/cook GL ǵ帮 
+    void init();
+
+    // ۾ 忡 ᵵ Ǵ κ (GL ȣ ):  + ˻, cache miss ŷ
+    bool prepare(const char* filename, CookedTexture& out);
+    void release(CookedTexture& tex);
+
+    //  : ؽó ü Ķ͸  (ε ä )
+    GLuint createTexture(const CookedTexture& tex);
+    // ε ؽó  ϳ ø. data CPU  Ǵ GL_PIXEL_UNPACK_BUFFER 
+    void uploadLevel(const CookedTexture& tex, int level, const void* data);
+
+    //  ε (prepare + ü  ε + release, init ڿ)
+    // ؽó  GL_REPEAT + Ʈ̸Ͼ(GL_LINEAR_MIPMAP_LINEAR) ؼ . ϸ 0
+    GLuint load(const char* filename);
+
+    //  .ctex  ٽ  (load ʿ  ˾Ƽ ȣ)
+    bool cook(const char* filename, const char* cookedPath);
+
+    //   ŷ (⺻: GL_EXT_texture_compression_s3tc  ,   ϸ   )
+    // init , ۾ 忡 û ֱ  θ 
+    void setCompressionEnabled(bool enabled);
+}
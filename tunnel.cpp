@@ -0,0 +1,522 @@
+#include "tunnel.h"
+#include "culling.h"
+#include "gl_state.h"
+#include "render_queue.h"
+#include "light_grid.h"
+#include "cpu_profiler.h"
+#include "course.h"
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Tunnel {
+    // ûũ ̿ ڽ  ùķ̼( )   
+    using Course::TRACK_START_Z;
+    using Course::CHUNK_LENGTH;
+    using Course::chunkStartZ;
+
+    //  ũ ( DrawSurvivalMap )
+    static const int MAP_WIDTH = 5;
+    static const int TUNNEL_HEIGHT = 5;
+    static const int CUBE_VERTEX_COUNT = 36;
+    static const int RING_SIZE = 8;              // GPU ûũ   ( 1 +  ̸ )
+    static const float MARKER_INTERVAL = 100.0f; //   Ÿ ǥ  (m)
+    static const float LAMP_INTERVAL = 6.0f;     //   (m,   )
+    static const float LAMP_HEIGHT = 2.5f;
+    static const float LAMP_RADIUS = 7.0f;
+    static const glm::vec3 LAMP_COLOR(1.0f, 0.75f, 0.45f);
+
+    //   (ûũ ͳ ܸ ģ 2D , acting3_vertex.glsl tunnelUnwrap  ħ)
+    // u:    (Ʒ) | ٴ(ޡ) |    (Ʒ), v: ûũ  z
+    static const float WALL_BOTTOM = -1.0f;                 //  Ÿ Ʒ  (wallY - wallH / 2)
+    static const float WALL_TOP = (float)TUNNEL_HEIGHT;     //  Ÿ  
+    static const float WALL_INNER_X = MAP_WIDTH - 0.25f;    //    ( β 0.5)
+    static const float FLOOR_TOP_Y = -0.95f;                // ٴ  (ٴ β 0.1)
+    static const int LIGHTMAP_TEXELS_PER_METER = 4;
+    static const int LIGHTMAP_WIDTH = (2 * (TUNNEL_HEIGHT + 1) + 2 * MAP_WIDTH) * LIGHTMAP_TEXELS_PER_METER; //  2 + ٴ
+    static const int LIGHTMAP_ROWS = (int)CHUNK_LENGTH * LIGHTMAP_TEXELS_PER_METER;   // ûũ ϳ  
+    static const float LIGHTMAP_SCALE = 2.0f;   // 0~2  RGBA8    (̴ ƾ )
+    static const float BAKE_AMBIENT = 0.3f;     //  ̴ ֺ  
+    static const float BAKE_SKY = 0.5f;         //   ä ( ĳ Ӹ   )
+    // ûũ ִ Ÿ :  (ٴ 10 +  2)  32 + ǥÿ 
+    static const int MAX_CHUNK_INSTANCES = (MAP_WIDTH * 2 + 2) * (int)CHUNK_LENGTH + 8;
+
+    // Ÿ νϽ ϳ (3~6  , 9~11  )
+    struct TileInstance {
+        glm::mat4 model;
+        glm::mat3 normal;  // transpose(inverse(mat3(model))), ۾ 忡 
+    };
+
+    // ۾ 尡  ûũ  (CPU , GL ȣ )
+    struct ChunkData {
+        int index;                        // ڽ ۺ  ° ûũ
+        std::vector<TileInstance> tiles;  // ûũ    Ÿ
+        glm::vec3 boundsMin;              // ûũ  AABB
+        glm::vec3 boundsMax;
+        std::vector<uint32_t> lightmap;   // LIGHTMAP_WIDTH x LIGHTMAP_ROWS, RGBA8
+    };
+
+    // GPU   (ó ִ ũ   Ҵϰ  )
+    struct ChunkSlot {
+        GLuint vao;
+        GLuint instanceVBO;
+        int index;            // ö ִ ûũ ȣ (-1 =  )
+        GLsizei instanceCount;
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+    };
+
+    static ChunkSlot g_slots[RING_SIZE];
+    static GLuint g_cubeVBO = 0;
+    static const ShaderProgram* g_shader = nullptr;          //  
+    static const ShaderProgram* g_litShader = nullptr;       // ǽð  (񱳿)
+    static GLuint g_lightmapAtlas = 0;   //  Ը LIGHTMAP_ROWS ྿ η  Ʋ
+    static bool g_lightmapEnabled = true;
+    static float g_courseLength = 0.0f;   // <= 0 ̸ 
+    static double g_originOffsetZ = 0.0;  // ÷  ( Z -  Z)
+    static int g_visibleChunkCount = 0;
+    static int g_lastChunkIndex = -1;      // ڽ  ûũ ȣ (  -1)
+
+    // ۾  ְ޴ ť
+    static std::thread g_worker;
+    static std::mutex g_queueMutex;
+    static std::condition_variable g_queueCond;
+    static std::deque<int> g_requests;     //   ûũ ȣ
+    static std::vector<ChunkData> g_done;  // ϼ ûũ ( 尡 GPU ø)
+    static std::vector<int> g_pending;     // û  ö  ûũ ȣ
+    static bool g_quit = false;
+
+    //  ϳ ( Z, ȣ ¦  )
+    struct Lamp {
+        double z;
+        float x;
+    };
+
+    //  Z  [absStart, absEnd]   (ڽ  ~ )
+    static void collectLamps(double absStart, double absEnd, std::vector<Lamp>& out) {
+        //    ٷ 
+        const float lampX = MAP_WIDTH - 0.6f;
+
+        absStart = std::max(absStart, (double)TRACK_START_Z);
+        if (g_courseLength > 0.0f) absEnd = std::min(absEnd, (double)g_courseLength);
+
+        long long first = (long long)std::ceil((absStart - TRACK_START_Z) / LAMP_INTERVAL);
+        for (long long i = first; TRACK_START_Z + i * LAMP_INTERVAL <= absEnd; ++i) {
+            Lamp lamp;
+            lamp.z = TRACK_START_Z + i * LAMP_INTERVAL;
+            lamp.x = (i % 2 == 0) ? -lampX : lampX;
+            out.push_back(lamp);
+        }
+    }
+
+    static void addTile(ChunkData& data, glm::vec3 position, glm::vec3 scale) {
+        glm::mat4 m = glm::translate(glm::mat4(1.0f), position);
+        TileInstance tile;
+        tile.model = glm::scale(m, scale);
+        // ̵ +   ũ̹Ƿ   ũ  밢 
+        tile.normal = glm::mat3(1.0f);
+        tile.normal[0][0] = 1.0f / scale.x;
+        tile.normal[1][1] = 1.0f / scale.y;
+        tile.normal[2][2] = 1.0f / scale.z;
+        data.tiles.push_back(tile);
+        data.boundsMin = glm::min(data.boundsMin, position - scale * 0.5f);
+        data.boundsMax = glm::max(data.boundsMax, position + scale * 0.5f);
+    }
+
+    // [Լ 1] ûũ  (۾ 忡 )
+    //  (z  x)  ,  ũ ٴ/ Ÿ 
+    //   / Ÿ ǥõ  ϴ.
+    static ChunkData generateChunk(int index) {
+        PROFILE_ZONE("Tunnel::generateChunk");
+        ChunkData data;
+        data.index = index;
+        data.boundsMin = glm::vec3(1e9f);
+        data.boundsMax = glm::vec3(-1e9f);
+        data.tiles.reserve(MAX_CHUNK_INSTANCES);
+
+        const float startZ = chunkStartZ(index);
+        float endZ = startZ + CHUNK_LENGTH;
+        if (g_courseLength > 0.0f && endZ > g_courseLength) endZ = g_courseLength;
+
+        const float wallH = (float)TUNNEL_HEIGHT + 1.0f;
+        const float wallY = (wallH / 2.0f) - 1.0f;
+
+        // Ÿ ǥ ûũ   (ū Z float е )
+        for (float z = startZ; z < endZ; z += 1.0f) {
+            float localZ = z - startZ;
+            for (int x = -MAP_WIDTH; x < MAP_WIDTH; ++x) {
+                // 1. ٴ (Floor)
+                addTile(data, glm::vec3(x * 1.0f, -1.0f, localZ), glm::vec3(1.5f, 0.1f, 1.0f));
+
+                // 2. 翷  (Walls)
+                if (abs(x) == MAP_WIDTH) {
+                    addTile(data, glm::vec3(x * 1.0f, wallY, localZ), glm::vec3(0.5f, wallH, 1.0f));
+                    addTile(data, glm::vec3(-x * 1.0f, wallY, localZ), glm::vec3(0.5f, wallH, 1.0f));
+                }
+            }
+        }
+
+        // 3.   (Ϲ ڽ) / 100m Ÿ ǥ ( ڽ)
+        if (g_courseLength > 0.0f) {
+            float goalZ = g_courseLength - 5.0f;
+            if (goalZ >= startZ && goalZ < startZ + CHUNK_LENGTH)
+                addTile(data, glm::vec3(0.0f, 0.1f, goalZ - startZ), glm::vec3(MAP_WIDTH * 2.5f, 0.1f, 1.0f));
+        }
+        else {
+            float firstMarker = std::ceil(startZ / MARKER_INTERVAL) * MARKER_INTERVAL;
+            for (float m = firstMarker; m < startZ + CHUNK_LENGTH; m += MARKER_INTERVAL) {
+                if (m <= 0.0f) continue;
+                addTile(data, glm::vec3(0.0f, -0.9f, m - startZ), glm::vec3(MAP_WIDTH * 2.0f, 0.05f, 0.5f));
+            }
+        }
+        return data;
+    }
+
+    static uint32_t packLightmapTexel(const glm::vec3& light) {
+        glm::vec3 c = glm::clamp(light / LIGHTMAP_SCALE, 0.0f, 1.0f) * 255.0f + 0.5f;
+        return (uint32_t)c.r | ((uint32_t)c.g << 8) | ((uint32_t)c.b << 16) | (0xFFu << 24);
+    }
+
+    // ûũ   (۾ , GL ȣ )
+    // 鸶 ֺ +  ä +  ݻ縸 (ݻ籤  ⿡  ޶  )
+    // ͳ ȿ   ü Ƿ ׸ڴ  ʽϴ.
+    static void bakeLightmap(ChunkData& data) {
+        PROFILE_ZONE("Tunnel::bakeLightmap");
+        const float startZ = chunkStartZ(data.index);
+        const float wallH = WALL_TOP - WALL_BOTTOM;
+        const float texel = 1.0f / LIGHTMAP_TEXELS_PER_METER;
+
+        //  ûũ   (ݰ游ŭ յ ), ġ ûũ 
+        std::vector<Lamp> lamps;
+        collectLamps(startZ - LAMP_RADIUS, startZ + CHUNK_LENGTH + LAMP_RADIUS, lamps);
+
+        data.lightmap.resize(LIGHTMAP_WIDTH * LIGHTMAP_ROWS);
+        for (int row = 0; row < LIGHTMAP_ROWS; ++row) {
+            float z = (row + 0.5f) * texel;
+            for (int col = 0; col < LIGHTMAP_WIDTH; ++col) {
+                float u = (col + 0.5f) * texel;
+
+                glm::vec3 p, n;
+                if (u < wallH) {                           //   (  Ʒ)
+                    p = glm::vec3(-WALL_INNER_X, WALL_TOP - u, z);
+                    n = glm::vec3(1.0f, 0.0f, 0.0f);
+                }
+                else if (u < wallH + 2.0f * MAP_WIDTH) {  // ٴ (  )
+                    p = glm::vec3(u - wallH - MAP_WIDTH, FLOOR_TOP_Y, z);
+                    n = glm::vec3(0.0f, 1.0f, 0.0f);
+                }
+                else {                                     //   (Ʒ  )
+                    p = glm::vec3(WALL_INNER_X, u - wallH - 2.0f * MAP_WIDTH + WALL_BOTTOM, z);
+                    n = glm::vec3(-1.0f, 0.0f, 0.0f);
+                }
+
+                glm::vec3 light(BAKE_AMBIENT + BAKE_SKY * (0.5f + 0.5f * n.y));
+                for (const Lamp& lamp : lamps) {
+                    // acting3_fragment.glsl clusterLights  
+                    glm::vec3 toLight = glm::vec3(lamp.x, LAMP_HEIGHT, (float)(lamp.z - startZ)) - p;
+                    float dist = glm::length(toLight);
+                    float falloff = glm::clamp(1.0f - dist / LAMP_RADIUS, 0.0f, 1.0f);
+                    falloff *= falloff;
+                    if (falloff <= 0.0f) continue;
+                    float diff = std::max(glm::dot(n, toLight / std::max(dist, 1e-4f)), 0.0f);
+                    light += diff * falloff * LAMP_COLOR;
+                }
+                data.lightmap[row * LIGHTMAP_WIDTH + col] = packLightmapTexel(light);
+            }
+        }
+    }
+
+    // [Լ 2] ۾  
+    static void workerLoop() {
+        PROFILE_THREAD("tunnel streaming");
+        while (true) {
+            int index;
+            {
+                std::unique_lock<std::mutex> lock(g_queueMutex);
+                g_queueCond.wait(lock, [] { return g_quit || !g_requests.empty(); });
+                if (g_quit) return;
+                index = g_requests.front();
+                g_requests.pop_front();
+            }
+
+            ChunkData data = generateChunk(index);
+            bakeLightmap(data);
+
+            std::lock_guard<std::mutex> lock(g_queueMutex);
+            g_done.push_back(std::move(data));
+        }
+    }
+
+    // ۾   (â ݱ  exit() ҷ ϵ atexit )
+    static void stopWorker() {
+        if (!g_worker.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(g_queueMutex);
+            g_quit = true;
+        }
+        g_queueCond.notify_all();
+        g_worker.join();
+    }
+
+    // [Լ 3]   ϳ  (  RING_SIZE )
+    static void createSlot(ChunkSlot& slot) {
+        slot.index = -1;
+        slot.instanceCount = 0;
+
+        glGenVertexArrays(1, &slot.vao);
+        GLState::bindVertexArray(slot.vao);
+
+        // 0~2: ؽó ť  (ġ, , UV) - tVAO  ġ
+        glBindBuffer(GL_ARRAY_BUFFER, g_cubeVBO);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+
+        // 3~6: νϽ  , 9~11: νϽ   (ִ ũ   Ҵ)
+        glGenBuffers(1, &slot.instanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, slot.instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, MAX_CHUNK_INSTANCES * sizeof(TileInstance), NULL, GL_DYNAMIC_DRAW);
+        for (int i = 0; i < 4; ++i) {
+            glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(TileInstance),
+                (void*)(offsetof(TileInstance, model) + i * sizeof(glm::vec4)));
+            glEnableVertexAttribArray(3 + i);
+            glVertexAttribDivisor(3 + i, 1);
+        }
+        for (int i = 0; i < 3; ++i) {
+            glVertexAttribPointer(9 + i, 3, GL_FLOAT, GL_FALSE, sizeof(TileInstance),
+                (void*)(offsetof(TileInstance, normal) + i * sizeof(glm::vec3)));
+            glEnableVertexAttribArray(9 + i);
+            glVertexAttribDivisor(9 + i, 1);
+        }
+        GLState::bindVertexArray(0);
+    }
+
+    // [Լ 4] ϼ ûũ Կ ø ( , glBufferSubData )
+    static void uploadChunk(const ChunkData& data) {
+        ChunkSlot& slot = g_slots[data.index % RING_SIZE];
+        slot.index = data.index;
+        slot.instanceCount = (GLsizei)data.tiles.size();
+        slot.boundsMin = data.boundsMin;
+        slot.boundsMax = data.boundsMax;
+
+        glBindBuffer(GL_ARRAY_BUFFER, slot.instanceVBO);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, data.tiles.size() * sizeof(TileInstance), data.tiles.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        //   Ʋ   ࿡ 
+        if (g_lightmapAtlas && !data.lightmap.empty()) {
+            GLState::activeTexture(GL_TEXTURE0 + LIGHTMAP_UNIT);
+            GLState::bindTexture(GL_TEXTURE_2D, g_lightmapAtlas);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, (data.index % RING_SIZE) * LIGHTMAP_ROWS,
+                LIGHTMAP_WIDTH, LIGHTMAP_ROWS, GL_RGBA, GL_UNSIGNED_BYTE, data.lightmap.data());
+            GLState::activeTexture(GL_TEXTURE0);
+        }
+    }
+
+    //   Ʋ (  ŭ ,     Ҵ)
+    static bool createLightmapAtlas() {
+        glGenTextures(1, &g_lightmapAtlas);
+        GLState::activeTexture(GL_TEXTURE0 + LIGHTMAP_UNIT);
+        GLState::bindTexture(GL_TEXTURE_2D, g_lightmapAtlas);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, LIGHTMAP_WIDTH, LIGHTMAP_ROWS * RING_SIZE, 0,
+            GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        GLState::activeTexture(GL_TEXTURE0);
+        return g_lightmapAtlas != 0;
+    }
+
+    // ÷̾ ִ ûũ  ũ⸸ŭ  [first, last]
+    static void computeWindow(float playerZ, int& first, int& last) {
+        double absZ = (double)playerZ + g_originOffsetZ;
+        int playerChunk = Course::getChunkIndex(absZ);
+        first = playerChunk - 1;
+        if (first < 0) first = 0;
+        last = first + RING_SIZE - 1;
+        if (g_lastChunkIndex >= 0 && last > g_lastChunkIndex) last = g_lastChunkIndex;
+    }
+
+    static bool isPending(int index) {
+        for (int p : g_pending) if (p == index) return true;
+        return false;
+    }
+
+    // [Լ 5] ͳ ʱȭ
+    //   , ù ȭ鿡 ʿ ûũ ٷ  ø  ۾ 带 մϴ.
+    bool initTunnel(ShaderVariants& shaders, GLuint cubeVBO, float courseLength) {
+        if (cubeVBO == 0) {
+            std::cerr << "ͳ ʱȭ : ť VBO ϴ" << std::endl;
+            return false;
+        }
+        g_shader = shaders.get(VARIANT_TEXTURED | VARIANT_INSTANCED | VARIANT_LIGHTMAPPED);
+        g_litShader = shaders.get(VARIANT_TEXTURED | VARIANT_LIT | VARIANT_INSTANCED);
+        if (!g_shader || !g_litShader) return false;
+        if (!createLightmapAtlas()) {
+            std::cerr << "ͳ ʱȭ :   ؽó   ϴ" << std::endl;
+            return false;
+        }
+        g_cubeVBO = cubeVBO;
+        g_courseLength = courseLength;
+        g_originOffsetZ = 0.0;
+        g_lastChunkIndex = Course::getLastChunkIndex(courseLength);
+
+        for (int i = 0; i < RING_SIZE; ++i) createSlot(g_slots[i]);
+
+        int first, last;
+        computeWindow(0.0f, first, last);
+        for (int i = first; i <= last; ++i) {
+            ChunkData data = generateChunk(i);
+            bakeLightmap(data);
+            uploadChunk(data);
+        }
+
+        g_quit = false;
+        g_worker = std::thread(workerLoop);
+        std::atexit(stopWorker);
+
+        std::cout << "[ͳ] ûũ  " << RING_SIZE << "ĭ غ Ϸ ("
+            << (courseLength > 0.0f ? "Ϲ ڽ" : " ڽ") << ")" << std::endl;
+        return true;
+    }
+
+    // [Լ 6] Ʈ 
+    // 1) ϼ ûũ   ʿ ͸ GPU ø
+    // 2)  ȿ  ְų ٸ ûũ   ۾ 忡 ûմϴ.
+    void updateStreaming(float playerZ) {
+        int first, last;
+        computeWindow(playerZ, first, last);
+
+        std::vector<ChunkData> done;
+        {
+            std::lock_guard<std::mutex> lock(g_queueMutex);
+            done.swap(g_done);
+        }
+        for (const auto& data : done) {
+            g_pending.erase(std::remove(g_pending.begin(), g_pending.end(), data.index), g_pending.end());
+            if (data.index >= first && data.index <= last) uploadChunk(data);
+        }
+
+        bool requested = false;
+        for (int i = first; i <= last; ++i) {
+            if (g_slots[i % RING_SIZE].index == i || isPending(i)) continue;
+            std::lock_guard<std::mutex> lock(g_queueMutex);
+            g_requests.push_back(i);
+            g_pending.push_back(i);
+            requested = true;
+        }
+        if (requested) g_queueCond.notify_one();
+    }
+
+    // [Լ 7] ͳ ׸
+    // 1) þ (window)  ûũ ٷ ǳʶٰ
+    // 2)  ûũ AABB ü  ̴ ͸  ť ֽϴ.
+    // ûũ ġ model uniform(ûũ  - ) ѱ, Ÿ  ûũ Դϴ.
+    void drawTunnel(GLuint textureID, const glm::mat4& viewProj, float windowStartZ, float windowEndZ) {
+        g_visibleChunkCount = 0;
+
+        Frustum frustum = Culling::extractFrustum(viewProj);
+
+        for (const auto& slot : g_slots) {
+            if (slot.index < 0 || slot.instanceCount == 0) continue;
+
+            float offsetZ = (float)(chunkStartZ(slot.index) - g_originOffsetZ);
+            if (offsetZ + CHUNK_LENGTH < windowStartZ || offsetZ > windowEndZ) continue;
+
+            glm::vec3 offset(0.0f, 0.0f, offsetZ);
+            if (!Culling::isAABBVisible(frustum, slot.boundsMin + offset, slot.boundsMax + offset)) continue;
+
+            //    Ƿ ûũ ߽ ̷ ա 
+            DrawPacket packet;
+            packet.vao = slot.vao;
+            packet.texture = textureID;
+            if (g_lightmapEnabled) {
+                int ringSlot = slot.index % RING_SIZE;
+                packet.shader = g_shader;
+                packet.lightmap = g_lightmapAtlas;
+                packet.lightmapRect = glm::vec4(0.0f, (float)ringSlot / RING_SIZE, 1.0f, 1.0f / RING_SIZE);
+            }
+            else {
+                packet.shader = g_litShader;
+            }
+            packet.instanced = true;
+            packet.count = CUBE_VERTEX_COUNT;
+            packet.instanceCount = slot.instanceCount;
+            packet.model = glm::translate(glm::mat4(1.0f), offset);
+            packet.sortCenter = (slot.boundsMin + slot.boundsMax) * 0.5f;
+            packet.profileScope = "tunnel";
+            RenderQueue::submit(packet);
+            g_visibleChunkCount++;
+        }
+    }
+
+    //  ٴ   , ̴ ü(κ ) Ŭ    
+    void submitLights(float windowStartZ, float windowEndZ) {
+        std::vector<Lamp> lamps;
+        collectLamps((double)windowStartZ + g_originOffsetZ, (double)windowEndZ + g_originOffsetZ, lamps);
+        for (const Lamp& lamp : lamps) {
+            float localZ = (float)(lamp.z - g_originOffsetZ);
+            LightGrid::addPointLight(glm::vec3(lamp.x, LAMP_HEIGHT, localZ), LAMP_COLOR, LAMP_RADIUS);
+        }
+    }
+
+    void setOriginOffset(double originOffsetZ) {
+        g_originOffsetZ = originOffsetZ;
+    }
+
+    void setLightmapEnabled(bool enabled) {
+        g_lightmapEnabled = enabled;
+    }
+
+    bool isLightmapEnabled() {
+        return g_lightmapEnabled;
+    }
+
+    int getChunkCount() {
+        int count = 0;
+        for (const auto& slot : g_slots) if (slot.index >= 0) count++;
+        return count;
+    }
+
+    int getVisibleChunkCount() {
+        return g_visibleChunkCount;
+    }
+
+    void cleanup() {
+        stopWorker();
+        g_requests.clear();
+        g_done.clear();
+        g_pending.clear();
+
+        for (auto& slot : g_slots) {
+            if (slot.instanceVBO) glDeleteBuffers(1, &slot.instanceVBO);
+            if (slot.vao) { GLState::forgetVertexArray(slot.vao); glDeleteVertexArrays(1, &slot.vao); }
+            slot.instanceVBO = 0;
+            slot.vao = 0;
+            slot.index = -1;
+        }
+        if (g_lightmapAtlas) {
+            GLState::forgetTexture(g_lightmapAtlas);
+            glDeleteTextures(1, &g_lightmapAtlas);
+            g_lightmapAtlas = 0;
+        }
+        g_visibleChunkCount = 0;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include "shader_program.h"
+
+// ͳ(ٴ +   + /Ÿ ǥ) Ʈ 
+// ڽ  (ûũ)  ÷̾  ûũ ۾ 忡 ̸ ,
+//   GPU ()  鼭 ̴ ûũ glDrawArraysInstanced ׸ϴ.
+// ڽ ƹ (  ) ޸𸮿 Ӵ  մϴ.
+// ٴڰ   Ƿ (ֺ +  ä + ) ûũ     ΰ,
+// ׸     ؽó մϴ (κ//  ǽð ).
+namespace Tunnel {
+    // cubeVBO: main.cpp ؽó ť(tVBO) ״ մϴ.
+    // shaders ؽó + νϽ (  / ǽð   ) ޾ ϴ.
+    // courseLength <= 0 ̸  ڽ (  100m Ÿ ǥ)
+    // ûũ  Course  (  World Course ޾ )
+    bool initTunnel(ShaderVariants& shaders, GLuint cubeVBO, float courseLength);
+
+    //   ȣ: playerZ( ǥ)  ʿ ûũ ûϰ,
+    // ۾ 尡  ûũ  ۿ øϴ.
+    void updateStreaming(float playerZ);
+
+    // viewProj: projection * view
+    // windowStartZ ~ windowEndZ( ǥ)  ûũ ü ˻  ٷ ǳʶݴϴ.
+    // ̴ ûũ RenderQueue ֱ⸸ ϰ  ׸ RenderQueue::flush մϴ.
+    void drawTunnel(GLuint textureID, const glm::mat4& viewProj, float windowStartZ, float windowEndZ);
+
+    //  () LightGrid : windowStartZ ~ windowEndZ( ǥ)  ͸
+    // ġ  ǥ (LAMP_INTERVAL) ̶  Űܵ ״Դϴ.
+    void submitLights(float windowStartZ, float windowEndZ);
+
+    // ÷ : World  Ű  ȣ ( =  - originOffset, World::getOriginOffset)
+    void setOriginOffset(double originOffsetZ);
+
+    //     ( ó ǽð Phong + Ŭ , 񱳿)
+    void setLightmapEnabled(bool enabled);
+    bool isLightmapEnabled();
+
+    int getChunkCount();        //    Ͱ ö ִ ûũ 
+    int getVisibleChunkCount(); //  drawTunnel  ׸ ûũ 
+
+    void cleanup();
+}
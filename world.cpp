@@ -0,0 +1,211 @@
+#include "world.h"
+#include "character_sim.h"
+#include "octopus_sim.h"
+#include "course.h"
+#include "cpu_profiler.h"
+
+#include <chrono>
+
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+
+namespace World {
+    static int g_frameSteps = 0;
+    static float g_frameUpdateMs = 0.0f;
+    static unsigned long long g_totalSteps = 0;
+
+    //    
+    static Phase g_phase = PHASE_READY;
+    static int g_readySteps = 0;          //  غ 
+    static unsigned int g_runSteps = 0;   //    
+    static unsigned int g_seed = 0;
+    static float g_courseLength = 0.0f;
+    static double g_originOffsetZ = 0.0;  //  Z -  Z
+    static float g_distance = 0.0f;
+
+    //  ġ( Z) ڽ   (Enemy::setAttackPatternSource)
+    static int courseAttackPattern(float localZ) {
+        return Course::getAttackPattern(g_seed, (double)localZ + g_originOffsetZ);
+    }
+
+    //  Ÿ ǥ ۰ : ĳͿ   ŭ ڷ 
+    static void updateFloatingOrigin() {
+        if (Character::getPosition().z < ORIGIN_REBASE_DISTANCE) return;
+        g_originOffsetZ += ORIGIN_REBASE_DISTANCE;
+        Character::shiftOrigin(-ORIGIN_REBASE_DISTANCE);
+        Enemy::shiftOrigin(-ORIGIN_REBASE_DISTANCE);
+    }
+
+    // Ű ¸ ĳͿ 
+    static void applyInput(const SimInput& input, float dt) {
+        // 8 Է ó
+        bool moveUp = input.up;
+        bool moveDown = input.down;
+        bool moveLeft = input.left;
+        bool moveRight = input.right;
+
+        bool ismoving = moveUp or moveDown or moveLeft or moveRight;
+
+        Character::setRunning(ismoving);
+
+        // ¿ ̵
+        if (moveUp) {
+            Character::moveForward(dt);
+        }
+        if (moveDown) {
+            Character::moveBackward(dt);
+        }
+        if (moveLeft) {
+            Character::moveLeft(dt);
+        }
+        if (moveRight) {
+            Character::moveRight(dt);
+        }
+
+        if (moveUp && moveRight) {
+            Character::setTargetRotation(glm::radians(-45.0f));
+        }
+        else if (moveUp && moveLeft) {
+            Character::setTargetRotation(glm::radians(45.0f));
+        }
+        else if (moveDown && moveRight) {
+            Character::setTargetRotation(glm::radians(-135.0f));
+        }
+        else if (moveDown && moveLeft) {
+            Character::setTargetRotation(glm::radians(135.0f));
+        }
+        else if (moveUp) {
+            // (+Z)   0 ( +Z  ִٰ )
+            Character::setTargetRotation(glm::radians(0.0f));
+        }
+        else if (moveDown) {
+            // (-Z)   180
+            Character::setTargetRotation(glm::radians(180.0f));
+        }
+        else if (moveLeft) {
+            // (+X) -> ī޶ Ƿ  Ű  +X 
+            Character::setTargetRotation(glm::radians(90.0f));
+        }
+        else if (moveRight) {
+            // (-X)
+            Character::setTargetRotation(glm::radians(-90.0f));
+        }
+
+        //  ( )
+        if (input.jump) {
+            Character::jump();
+        }
+    }
+
+    void startRun(unsigned int seed, float courseLength) {
+        g_seed = seed;
+        g_courseLength = courseLength;
+        g_originOffsetZ = 0.0;
+        g_distance = 0.0f;
+        g_phase = PHASE_READY;
+        g_readySteps = READY_STEPS;
+        g_runSteps = 0;
+        Character::resetState();
+        Enemy::resetState();
+        Enemy::setAttackPatternSource(courseAttackPattern);
+    }
+
+    void step(const SimInput& input) {
+        if (g_phase == PHASE_FINISHED) return;
+
+        bool playing = g_phase == PHASE_PLAYING;
+        update(STEP_DT, input, playing);
+        updateFloatingOrigin();
+        g_distance = (float)(g_originOffsetZ + Character::getPosition().z);
+
+        if (playing) {
+            g_runSteps++;
+            if (g_courseLength > 0.0f && g_distance >= g_courseLength) g_phase = PHASE_FINISHED;
+        }
+        else if (--g_readySteps <= 0) {
+            g_phase = PHASE_PLAYING;   //  ܺ Է/
+        }
+    }
+
+    void update(float dt, const SimInput& input, bool playing) {
+        PROFILE_ZONE("World::update");
+        auto start = std::chrono::steady_clock::now();
+
+        if (playing) applyInput(input, dt);
+        Character::update(dt);
+
+        //  ŵ ĳ ġ  ̰, 浹    
+        if (playing) {
+            glm::vec3 characterPos = Character::getPosition();
+            Enemy::updateOctopus(characterPos, dt);
+            PlayerStun stunInfo = { false, 0.0f, 0.0f };
+            if (Enemy::checkElectricityCollision(characterPos, 0.5f, stunInfo)) {
+                Character::applyStun(stunInfo.stunDuration);
+            }
+        }
+
+        g_frameSteps++;
+        g_totalSteps++;
+        g_frameUpdateMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    Phase getPhase() {
+        return g_phase;
+    }
+
+    float getRunTime() {
+        return g_runSteps * STEP_DT;
+    }
+
+    float getDistance() {
+        return g_distance;
+    }
+
+    float getCourseLength() {
+        return g_courseLength;
+    }
+
+    unsigned int getSeed() {
+        return g_seed;
+    }
+
+    double getOriginOffset() {
+        return g_originOffsetZ;
+    }
+
+    void beginFrame() {
+        g_frameSteps = 0;
+        g_frameUpdateMs = 0.0f;
+    }
+
+    int getFrameSteps() {
+        return g_frameSteps;
+    }
+
+    float getFrameUpdateMs() {
+        return g_frameUpdateMs;
+    }
+
+    unsigned long long getTotalSteps() {
+        return g_totalSteps;
+    }
+
+    unsigned int hashBytes(unsigned int h, const void* data, size_t size) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; ++i) {
+            h ^= bytes[i];
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    unsigned int checksum() {
+        unsigned int h = 2166136261u;
+        h = hashBytes(h, &g_phase, sizeof(g_phase));
+        h = hashBytes(h, &g_runSteps, sizeof(g_runSteps));
+        h = hashBytes(h, &g_originOffsetZ, sizeof(g_originOffsetZ));
+        h = Character::hashState(h);
+        h = Enemy::hashState(h);
+        return h;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+
+//    Է (Ű ũƮ  · World::update ѱ)
+struct SimInput {
+    bool up;
+    bool down;
+    bool left;
+    bool right;
+    bool jump;      // ̹ ܿ    ( ִ  ƴ϶  )
+};
+
+// ùķ̼   (GL ,  SimulationStep 帮    )
+// Է -> ĳ -> / -> 浹   ý ܴ Ȯ   ϴ.
+// ׸ Լ(Character::drawCharacter, Enemy::draw*, submitLights) ⼭  ¸ б⸸ մϴ.
+//   (غ īƮٿ,   ð, ) ڽ(õ, , ÷ ) ⼭  ־
+//  õ +  ܺ Է̸ Ӱ 帮  ڽ   ޸ϴ.
+namespace World {
+    static const float STEP_HZ = 120.0f;            //   
+    static const float STEP_DT = 1.0f / STEP_HZ;    // update ѱ dt (׻  )
+    static const int READY_STEPS = 240;             // غ īƮٿ (2,  )
+    static const float ORIGIN_REBASE_DISTANCE = 256.0f; // ĳͰ   Z   ̵ (ûũ  32m )
+
+    enum Phase {
+        PHASE_READY,      // īƮٿ: Է/  ĳ͸ ()
+        PHASE_PLAYING,
+        PHASE_FINISHED    //  (step   )
+    };
+
+    //   : ĳ/   ·,  0, غ īƮٿ
+    // seed: ڽ   (Course), courseLength <= 0 ̸  ڽ ( )
+    void startRun(unsigned int seed, float courseLength);
+
+    //   ϳ (STEP_DT): update ->  ̵ -> Ÿ/ -> غ/ ð
+    // Է PHASE_PLAYING   (غ ߿ ѱ Է )
+    void step(const SimInput& input);
+
+    //  ϳ ý  (step θ). playing false Է/  ĳ͸ 
+    void update(float dt, const SimInput& input, bool playing);
+
+    Phase getPhase();
+    float getRunTime();         //   ð (غ ,    STEP_DT)
+    float getDistance();        // ߼   Ÿ (m)
+    float getCourseLength();    // <= 0 ̸ 
+    unsigned int getSeed();
+    // ÷ :  Z =  Z +   (step ORIGIN_REBASE_DISTANCE þ)
+    //   ٲ ī޶ ͳ  ű
+    double getOriginOffset();
+
+    // ùķ̼  (׸ ): Ӹ beginFrame  update 
+    void beginFrame();
+    int getFrameSteps();        // ̹ ӿ   
+    float getFrameUpdateMs();   // ̹  update ð  (ms)
+    unsigned long long getTotalSteps();
+
+    //  üũ ( / + ĳ + /, ȭ   񱳿, FNV-1a)
+    unsigned int checksum();
+    unsigned int hashBytes(unsigned int h, const void* data, size_t size);
+}